@@ -2,18 +2,953 @@
 // SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
 
 #include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <ostream>
 #include <iostream>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace cexa::impl {
+
+std::optional<long long> parse_integer(const std::string& value, int base) {
+  const char* begin = value.data();
+  const char* end   = value.data() + value.size();
+  while (begin < end && std::isspace(static_cast<unsigned char>(*begin))) {
+    begin++;
+  }
+  while (end > begin && std::isspace(static_cast<unsigned char>(end[-1]))) {
+    end--;
+  }
+
+  const bool hex_prefix = end - begin > 2 && begin[0] == '0' &&
+                          (begin[1] == 'x' || begin[1] == 'X');
+  if (base == 0) {
+    base = hex_prefix ? 16 : 10;
+  }
+  if (base == 16 && hex_prefix) {
+    begin += 2;
+  }
+
+  long long result;
+  auto [last, ec] = std::from_chars(begin, end, result, base);
+  if (ec != std::errc() || last != end || begin == end) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+std::vector<std::size_t> parse_cpu_list(const std::string& cpu_list) {
+  std::vector<std::size_t> cpus;
+  std::stringstream ss(cpu_list);
+  std::string range;
+
+  while (std::getline(ss, range, ',')) {
+    if (range.empty() || !std::isdigit(range.front())) {
+      continue;
+    }
+
+    // Malformed ranges, such as "3-", are skipped
+    std::size_t dash               = range.find('-');
+    std::optional<long long> first = parse_integer(range.substr(0, dash));
+    std::optional<long long> last  = parse_integer(
+        dash == std::string::npos ? range : range.substr(dash + 1));
+    if (!first.has_value() || !last.has_value() || last.value() < 0 ||
+        first.value() > last.value()) {
+      continue;
+    }
+    for (long long cpu = first.value(); cpu <= last.value(); cpu++) {
+      cpus.push_back(static_cast<std::size_t>(cpu));
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::string format_cpu_list(std::vector<std::size_t> cpus) {
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  std::stringstream ss;
+  for (std::size_t i = 0; i < cpus.size();) {
+    std::size_t j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+      j++;
+    }
+
+    if (i != 0) {
+      ss << ',';
+    }
+    ss << cpus[i];
+    if (j != i) {
+      ss << '-' << cpus[j];
+    }
+    i = j + 1;
+  }
+  return ss.str();
+}
+
+std::optional<std::uint32_t> make_midr(const std::string& implementer,
+                                       const std::string& variant,
+                                       const std::string& part,
+                                       const std::string& revision) {
+  // The fields are printed in hexadecimal ("0x41") except the revision
+  std::optional<long long> fields[] = {
+      parse_integer(implementer, 0), parse_integer(variant, 0),
+      parse_integer(part, 0), parse_integer(revision, 0)};
+  const long long max_fields[] = {0xff, 0xf, 0xfff, 0xf};
+  for (std::size_t i = 0; i < 4; i++) {
+    if (!fields[i].has_value() || fields[i].value() < 0 ||
+        fields[i].value() > max_fields[i]) {
+      return std::nullopt;
+    }
+  }
+
+  // Architecture 0xf: the features are described by the ID registers
+  return static_cast<std::uint32_t>(fields[0].value() << 24 |
+                                    fields[1].value() << 20 | 0xf << 16 |
+                                    fields[2].value() << 4 | fields[3].value());
+}
+
+arm_cpu_info decode_midr(std::uint32_t midr) {
+  struct arm_part {
+    std::uint32_t implementer;
+    std::uint32_t part;
+    const char* name;
+  };
+  static const std::map<std::uint32_t, const char*> vendors = {
+      {0x41, "ARM"},     {0x42, "Broadcom"},  {0x43, "Cavium"},
+      {0x46, "Fujitsu"}, {0x48, "HiSilicon"}, {0x4e, "NVIDIA"},
+      {0x50, "APM"},     {0x51, "Qualcomm"},  {0x61, "Apple"},
+      {0xc0, "Ampere"}};
+  static const arm_part parts[] = {
+      {0x41, 0xd03, "Cortex-A53"},   {0x41, 0xd04, "Cortex-A35"},
+      {0x41, 0xd05, "Cortex-A55"},   {0x41, 0xd07, "Cortex-A57"},
+      {0x41, 0xd08, "Cortex-A72"},   {0x41, 0xd09, "Cortex-A73"},
+      {0x41, 0xd0a, "Cortex-A75"},   {0x41, 0xd0b, "Cortex-A76"},
+      {0x41, 0xd0c, "Neoverse-N1"},  {0x41, 0xd0d, "Cortex-A77"},
+      {0x41, 0xd40, "Neoverse-V1"},  {0x41, 0xd41, "Cortex-A78"},
+      {0x41, 0xd44, "Cortex-X1"},    {0x41, 0xd46, "Cortex-A510"},
+      {0x41, 0xd47, "Cortex-A710"},  {0x41, 0xd48, "Cortex-X2"},
+      {0x41, 0xd49, "Neoverse-N2"},  {0x41, 0xd4a, "Neoverse-E1"},
+      {0x41, 0xd4d, "Cortex-A715"},  {0x41, 0xd4e, "Cortex-X3"},
+      {0x41, 0xd4f, "Neoverse-V2"},  {0x41, 0xd80, "Cortex-A520"},
+      {0x41, 0xd81, "Cortex-A720"},  {0x41, 0xd82, "Cortex-X4"},
+      {0x41, 0xd84, "Neoverse-V3"},  {0x41, 0xd8e, "Neoverse-N3"},
+      {0x42, 0x516, "ThunderX2"},    {0x43, 0x0a1, "ThunderX"},
+      {0x43, 0x0af, "ThunderX2"},    {0x46, 0x001, "A64FX"},
+      {0x48, 0xd01, "Kunpeng-920"},  {0x4e, 0x004, "Carmel"},
+      {0x50, 0x000, "X-Gene"},       {0x51, 0x800, "Kryo-2XX"},
+      {0x51, 0xc00, "Falkor"},       {0x61, 0x022, "M1-Icestorm"},
+      {0x61, 0x023, "M1-Firestorm"}, {0xc0, 0xac3, "Ampere-1"},
+      {0xc0, 0xac4, "Ampere-1a"}};
+
+  arm_cpu_info info;
+  info.midr        = midr;
+  info.implementer = midr >> 24 & 0xff;
+  info.variant     = midr >> 20 & 0xf;
+  info.part        = midr >> 4 & 0xfff;
+  info.revision    = midr & 0xf;
+
+  auto vendor    = vendors.find(info.implementer);
+  info.vendor    = vendor != vendors.end() ? vendor->second : "Unknown";
+  info.part_name = "Unknown";
+  for (const arm_part& part : parts) {
+    if (part.implementer == info.implementer && part.part == info.part) {
+      info.part_name = part.name;
+    }
+  }
+  return info;
+}
+
+std::string get_user_cache_file(const std::string& name) {
+  namespace fs = std::filesystem;
+
+  fs::path cache_dir;
+  if (const char* xdg_cache = std::getenv("XDG_CACHE_HOME")) {
+    cache_dir = xdg_cache;
+  } else if (const char* home = std::getenv("HOME")) {
+    cache_dir = fs::path(home) / ".cache";
+  } else {
+    return "";
+  }
+  return (cache_dir / "cexa" / name).string();
+}
+
+std::string get_snapshot_cache_file(const std::string& host_id) {
+  const char* env   = std::getenv("CEXA_ARCHINFO_CACHE");
+  std::string value = env ? env : "";
+  if (value.empty() || value == "0" || value == "OFF") {
+    return "";
+  }
+  if (value == "1" || value == "ON") {
+    // The user cache directory may be shared by the nodes of a cluster
+    std::string name = "snapshot." + host_id;
+    for (char& c : name) {
+      if (c == '/' || c == '\\' ||
+          std::isspace(static_cast<unsigned char>(c))) {
+        c = '_';
+      }
+    }
+    return get_user_cache_file(name);
+  }
+  return value;
+}
+
+void read_key_values(std::istream& stream, char separator,
+                     const std::string& prefix, bool first_block_only,
+                     snapshot_values& values) {
+  auto trim = [](std::string str) {
+    str.erase(0, str.find_first_not_of(" \t"));
+    str.erase(str.find_last_not_of(" \t") + 1);
+    return str;
+  };
+
+  std::string line;
+  while (std::getline(stream, line)) {
+    if (line.empty() && first_block_only) {
+      break;
+    }
+    std::size_t pos = line.find(separator);
+    if (line.empty() || line.front() == '#' || pos == std::string::npos) {
+      continue;
+    }
+    values[prefix + trim(line.substr(0, pos))] = trim(line.substr(pos + 1));
+  }
+}
+
+// The first line of the cache file identifies the boot and version:
+// "cexa-snapshot v<version> <boot id>", followed by one "<key>\t<value>" line
+// per value
+std::optional<snapshot_values> load_snapshot(const std::string& cache_file,
+                                             const std::string& boot_id) {
+  std::ifstream file(cache_file);
+  std::string line;
+  if (!std::getline(file, line) ||
+      line != "cexa-snapshot v" + std::to_string(snapshot_version) + " " +
+                  boot_id) {
+    return std::nullopt;
+  }
+
+  snapshot_values values;
+  while (std::getline(file, line)) {
+    std::size_t tab = line.find('\t');
+    if (tab != std::string::npos) {
+      values[line.substr(0, tab)] = line.substr(tab + 1);
+    }
+  }
+  return values;
+}
+
+void write_file_atomically(const std::string& path,
+                           const std::string& content) {
+  namespace fs = std::filesystem;
+
+  std::error_code ec;
+  fs::create_directories(fs::path(path).parent_path(), ec);
+  const std::string tmp_file =
+      path + "." + std::to_string(std::random_device()());
+  {
+    std::ofstream file(tmp_file, std::ios::trunc);
+    file << content;
+    if (!file) {
+      fs::remove(tmp_file, ec);
+      return;
+    }
+  }
+  fs::rename(tmp_file, path, ec);
+  if (ec) {
+    fs::remove(tmp_file, ec);
+  }
+}
+
+void save_snapshot(const std::string& cache_file, const std::string& boot_id,
+                   const snapshot_values& values) {
+  std::string content = "cexa-snapshot v" + std::to_string(snapshot_version) +
+                        ' ' + boot_id + '\n';
+  for (const auto& [key, value] : values) {
+    content += key + '\t' + value + '\n';
+  }
+  write_file_atomically(cache_file, content);
+}
+
+std::string escape_cache_key(const std::string& key) {
+  std::string escaped;
+  for (char c : key) {
+    switch (c) {
+      case '\\': escaped += "\\\\"; break;
+      case '\t': escaped += "\\t"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\r': escaped += "\\r"; break;
+      default: escaped += c;
+    }
+  }
+  return escaped;
+}
+
+std::optional<std::string> load_cache_entry(const std::string& cache_file,
+                                            const std::string& key) {
+  const std::string escaped_key = escape_cache_key(key);
+  std::ifstream file(cache_file);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::size_t tab = line.find('\t');
+    if (tab != std::string::npos && line.compare(0, tab, escaped_key) == 0) {
+      return line.substr(tab + 1);
+    }
+  }
+  return std::nullopt;
+}
+
+void save_cache_entry(const std::string& cache_file, const std::string& key,
+                      const std::string& values) {
+  const std::string escaped_key = escape_cache_key(key);
+  // Keep the entries of the other keys sharing this file
+  std::string content;
+  std::ifstream old_file(cache_file);
+  std::string line;
+  while (std::getline(old_file, line)) {
+    if (line.substr(0, line.find('\t')) != escaped_key) {
+      content += line + '\n';
+    }
+  }
+  old_file.close();
+
+  write_file_atomically(cache_file,
+                        content + escaped_key + '\t' + values + '\n');
+}
+
+std::vector<memory_device> parse_smbios_memory_devices(
+    const std::vector<unsigned char>& table) {
+  auto read = [&](std::size_t offset, std::size_t n_bytes) {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < n_bytes; i++) {
+      value |= std::uint64_t(table[offset + i]) << (8 * i);
+    }
+    return value;
+  };
+
+  std::vector<memory_device> devices;
+  for (std::size_t pos = 0; pos + 4 <= table.size();) {
+    const std::size_t type   = table[pos];
+    const std::size_t length = table[pos + 1];
+    if (length < 4 || pos + length > table.size()) {
+      break;
+    }
+
+    // The formatted area is followed by its strings, ended by two nul bytes
+    std::vector<std::string> strings;
+    std::size_t end = pos + length;
+    while (end < table.size() && table[end] != 0) {
+      std::string str;
+      while (end < table.size() && table[end] != 0) {
+        str += static_cast<char>(table[end++]);
+      }
+      strings.push_back(str);
+      end++;
+    }
+    end = std::min(end + (strings.empty() ? 2 : 1), table.size());
+
+    // Type 17: memory device, type 127: end of table
+    if (type == 127) {
+      break;
+    }
+    if (type == 17 && length >= 0x17) {
+      auto string_at = [&](std::size_t offset) {
+        std::size_t index = table[pos + offset];
+        return index > 0 && index <= strings.size() ? strings[index - 1] : "";
+      };
+
+      memory_device device;
+      device.locator = string_at(0x10);
+
+      std::size_t data_width = read(pos + 0x0A, 2);
+      device.data_width      = data_width == 0xFFFF ? 0 : data_width;
+
+      // 0x7FFF: the size in MiB is in the extended size field. The size is in
+      // KiB when bit 15 is set
+      std::size_t size = read(pos + 0x0C, 2);
+      if (size == 0x7FFF && length >= 0x20) {
+        device.size = read(pos + 0x1C, 4) << 20;
+      } else if (size != 0xFFFF) {
+        device.size = (size & 0x7FFF) << (size & 0x8000 ? 10 : 20);
+      }
+
+      static const std::map<std::size_t, std::string> memory_types = {
+          {0x12, "DDR"},    {0x13, "DDR2"},   {0x18, "DDR3"},
+          {0x1A, "DDR4"},   {0x1B, "LPDDR"},  {0x1C, "LPDDR2"},
+          {0x1D, "LPDDR3"}, {0x1E, "LPDDR4"}, {0x1F, "Logical non-volatile"},
+          {0x20, "HBM"},    {0x21, "HBM2"},   {0x22, "DDR5"},
+          {0x23, "LPDDR5"}, {0x24, "HBM3"}};
+      auto memory_type = memory_types.find(table[pos + 0x12]);
+      if (memory_type != memory_types.end()) {
+        device.type = memory_type->second;
+      }
+
+      // Prefer the configured speed (SMBIOS 2.7) to the maximum speed of the
+      // DIMM. 0xFFFF: the speed is in the extended speed fields (SMBIOS 3.3)
+      std::size_t speed = read(pos + 0x15, 2);
+      if (speed == 0xFFFF && length >= 0x58) {
+        speed = read(pos + 0x54, 4);
+      }
+      if (length >= 0x22) {
+        std::size_t configured_speed = read(pos + 0x20, 2);
+        if (configured_speed == 0xFFFF && length >= 0x5C) {
+          configured_speed = read(pos + 0x58, 4);
+        }
+        speed = configured_speed != 0 ? configured_speed : speed;
+      }
+      device.speed = device.size != 0 ? speed : 0;
+
+      devices.push_back(device);
+    }
+
+    pos = end;
+  }
+
+  return devices;
+}
+
+double get_theoretical_bandwidth(const std::vector<memory_device>& devices) {
+  double bandwidth = 0.;
+  for (const memory_device& device : devices) {
+    if (device.size == 0) {
+      continue;
+    }
+    if (device.speed == 0 || device.data_width == 0) {
+      return 0.;
+    }
+    // MT/s * bytes per transfer
+    bandwidth += device.speed * 1e6 * (device.data_width / 8) * 1e-9;
+  }
+  return bandwidth;
+}
+
+std::string check_memory_bandwidth(const memory_info& info,
+                                   double measured_bandwidth) {
+  std::vector<std::string> issues;
+  if (info.populated_slots < info.devices.size()) {
+    issues.push_back(std::to_string(info.devices.size() -
+                                    info.populated_slots) +
+                     " empty memory slot(s)");
+  }
+
+  // STREAM like kernels usually reach 70 to 90% of the peak
+  std::stringstream ss;
+  if (info.theoretical_bandwidth > 0. && measured_bandwidth > 0.) {
+    double efficiency = measured_bandwidth / info.theoretical_bandwidth;
+    if (efficiency < 0.5) {
+      issues.push_back("low bandwidth");
+    }
+    ss << measured_bandwidth << " of " << info.theoretical_bandwidth
+       << " GB/s (" << static_cast<int>(100. * efficiency + 0.5) << "%)";
+  } else if (issues.empty()) {
+    return "N/A: the theoretical bandwidth is unknown";
+  } else {
+    ss << "theoretical bandwidth unknown";
+  }
+
+  std::string prefix = issues.empty() ? "OK: " : "WARNING: ";
+  for (const std::string& issue : issues) {
+    prefix += issue + ", ";
+  }
+  return prefix + ss.str();
+}
+
+double get_min_timer_duration(double overhead, double granularity) {
+  // A measurement is off by up to one tick and one read of the timer
+  return 100. * (overhead + granularity);
+}
+
+// Invariant TSC bit of CPUID leaf 0x80000007
+std::string get_invariant_tsc() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int regs[4];
+  __cpuid(regs, 0x80000000);
+  if (static_cast<unsigned>(regs[0]) < 0x80000007) {
+    return "no";
+  }
+  __cpuid(regs, 0x80000007);
+  return (regs[3] >> 8) & 1 ? "yes" : "no";
+#elif defined(__x86_64__) || defined(__i386__)
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+    return "no";
+  }
+  return (edx >> 8) & 1 ? "yes" : "no";
+#else
+  return "N/A";
+#endif
+}
+
+timer_info measure_timer() {
+  timer_info info;
+  info.clocksource   = read_clocksource();
+  info.invariant_tsc = get_invariant_tsc();
+
+  // Overhead of back to back reads
+  constexpr int n_reads = 1 << 16;
+  Kokkos::Timer timer;
+  for (int i = 0; i < n_reads; i++) {
+    timer.seconds();
+  }
+  const double total = timer.seconds();
+  info.overhead      = total / n_reads * 1e9;
+
+  // Smallest step seen between two different reads
+  double granularity = total;
+  for (int i = 0; i < 1000; i++) {
+    double start = timer.seconds(), end = start;
+    while (end == start) {
+      end = timer.seconds();
+    }
+    granularity = std::min(granularity, end - start);
+  }
+  info.granularity = granularity * 1e9;
+
+  info.min_duration = get_min_timer_duration(info.overhead, info.granularity);
+  return info;
+}
+
+}  // namespace cexa::impl
 
 namespace cexa {
 
+memory_info get_memory_info() {
+  static const memory_info info = [] {
+    memory_info info;
+    info.devices = impl::parse_smbios_memory_devices(impl::read_smbios_table());
+    info.source  = "SMBIOS";
+    if (info.devices.empty()) {
+      info.devices =
+          impl::read_edac_memory_devices("/sys/devices/system/edac/mc");
+      info.source = info.devices.empty() ? "N/A" : "EDAC";
+    }
+
+    for (const memory_device& device : info.devices) {
+      info.populated_slots += device.size != 0;
+    }
+    info.theoretical_bandwidth = impl::get_theoretical_bandwidth(info.devices);
+
+    if (const char* bandwidth = std::getenv("CEXA_DRAM_BANDWIDTH")) {
+      info.theoretical_bandwidth = std::atof(bandwidth);
+      info.source                = "CEXA_DRAM_BANDWIDTH";
+    }
+    return info;
+  }();
+  return info;
+}
+
+std::string check_memory_bandwidth(double measured_bandwidth) {
+  return impl::check_memory_bandwidth(get_memory_info(), measured_bandwidth);
+}
+
+timer_info get_timer_info() {
+  static const timer_info info = impl::measure_timer();
+  return info;
+}
+
+std::size_t get_timer_repetitions(double duration) {
+  const double min_duration = get_timer_info().min_duration * 1e-9;
+  if (duration <= 0.) {
+    return 1;
+  }
+  return std::max<std::size_t>(std::ceil(min_duration / duration), 1);
+}
+
+namespace impl {
+
+double time_launches(const std::function<void()>& launch) {
+  double best_time = 0.;
+  for (int repetition = 0; repetition < 4; repetition++) {
+    Kokkos::Timer timer;
+    launch();
+    Kokkos::fence("cexa::time_launches");
+    double time = timer.seconds();
+
+    if (repetition == 1 || (repetition > 1 && time < best_time)) {
+      best_time = time;
+    }
+  }
+  return best_time;
+}
+
+}  // namespace impl
+
 // Kokkos can use a subset of the available threads
 std::size_t get_kokkos_concurrency() { return Kokkos::num_threads(); }
 
+std::vector<thread_binding> get_kokkos_thread_binding() {
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+
+  const std::size_t n_threads = exec_space().concurrency();
+  // Several iterations per thread and several rounds so that every thread of
+  // the pool gets sampled and migrations have a chance to show up
+  const std::size_t n_samples = 16 * n_threads;
+  const int n_rounds          = 4;
+
+  std::vector<std::set<int>> cpus_per_thread(n_threads);
+  // CPU of each thread in the latest round it was sampled in
+  std::vector<int> last_cpus(n_threads, -1);
+  std::vector<int> ranks(n_samples), cpus(n_samples);
+
+  for (int round = 0; round < n_rounds; round++) {
+    int* ranks_ptr = ranks.data();
+    int* cpus_ptr  = cpus.data();
+    Kokkos::parallel_for(
+        "cexa::get_kokkos_thread_binding",
+        Kokkos::RangePolicy<exec_space, Kokkos::Schedule<Kokkos::Static>>(
+            0, n_samples),
+        [=](std::size_t i) {
+          ranks_ptr[i] = exec_space::impl_thread_pool_rank();
+          cpus_ptr[i]  = impl::get_current_cpu();
+        });
+    Kokkos::fence("cexa::get_kokkos_thread_binding");
+
+    for (std::size_t i = 0; i < n_samples; i++) {
+      if (ranks[i] >= 0 && static_cast<std::size_t>(ranks[i]) < n_threads) {
+        cpus_per_thread[ranks[i]].insert(cpus[i]);
+        last_cpus[ranks[i]] = cpus[i];
+      }
+    }
+  }
+
+  std::vector<numa_node> nodes = get_numa_nodes();
+  auto node_of = [&](int cpu) {
+    for (const numa_node& node : nodes) {
+      if (std::binary_search(node.cpus.begin(), node.cpus.end(),
+                             static_cast<std::size_t>(cpu))) {
+        return static_cast<int>(node.id);
+      }
+    }
+    return -1;
+  };
+
+  std::vector<thread_binding> bindings;
+  for (std::size_t thread = 0; thread < n_threads; thread++) {
+    thread_binding binding;
+    binding.thread_id = thread;
+    if (!cpus_per_thread[thread].empty()) {
+      binding.cpu       = last_cpus[thread];
+      binding.migrated  = cpus_per_thread[thread].size() > 1;
+      binding.numa_node = binding.cpu < 0 ? -1 : node_of(binding.cpu);
+    }
+    bindings.push_back(binding);
+  }
+  return bindings;
+}
+
+namespace impl {
+
+std::string check_cpu_frequencies(const std::vector<cpu_frequency>& frequencies,
+                                  const std::string& boost_state) {
+  if (frequencies.empty()) {
+    return "OK: no frequency scaling settings found";
+  }
+
+  // Number of CPUs per issue, to keep the diagnostic on one line
+  std::map<std::string, std::size_t> issues;
+  for (const cpu_frequency& frequency : frequencies) {
+    const std::string& governor = frequency.governor;
+    const std::string& epp      = frequency.energy_performance_preference;
+    // Nothing to report when neither the governor nor the preference is known
+    if (governor != "performance" && epp != "performance" &&
+        !(governor.empty() && epp.empty())) {
+      std::string policy = governor;
+      if (!epp.empty()) {
+        policy += (policy.empty() ? "" : "/") + epp;
+      }
+      issues["governor " + policy]++;
+    }
+    if (frequency.max > 0. && frequency.max < 0.99 * frequency.hardware_max) {
+      issues["max frequency capped"]++;
+    }
+  }
+
+  std::stringstream ss;
+  ss << (issues.empty() && boost_state != "disabled" ? "OK: " : "WARNING: ");
+  for (const auto& [issue, n_cpus] : issues) {
+    ss << issue << " on " << n_cpus << " CPU(s), ";
+  }
+  if (boost_state == "disabled") {
+    ss << "boost disabled, ";
+  }
+  ss << frequencies.size() << " CPU(s) checked";
+  return ss.str();
+}
+
+std::vector<std::string> lint_host_performance(
+    const kernel_tunables& tunables, std::size_t n_numa_nodes,
+    bool kokkos_uses_smt) {
+  std::vector<std::string> issues;
+
+  if (tunables.numa_balancing == "1" && n_numa_nodes > 1) {
+    issues.push_back(
+        "automatic NUMA balancing is enabled, it migrates the pages placed by "
+        "first touch and slows down memory bound kernels "
+        "(kernel.numa_balancing=0)");
+  }
+  if (tunables.zone_reclaim_mode != "N/A" &&
+      tunables.zone_reclaim_mode != "0") {
+    issues.push_back(
+        "zone reclaim is enabled, allocations stall reclaiming node local "
+        "memory instead of using remote nodes (vm.zone_reclaim_mode=0)");
+  }
+  if (tunables.overcommit_memory == "2") {
+    issues.push_back(
+        "overcommit is disabled, large Views are accounted at their full size "
+        "against the commit limit (vm.overcommit_memory)");
+  }
+  if (tunables.transparent_hugepage == "never") {
+    issues.push_back(
+        "transparent huge pages are disabled, large Views suffer from TLB "
+        "misses");
+  }
+  // Unknown or malformed values are not reported
+  std::optional<long> migration_cost =
+      parse_integer(tunables.sched_migration_cost_ns);
+  if (migration_cost.has_value() && migration_cost.value() < 500000) {
+    issues.push_back(
+        "the scheduler migration cost is lower than the default, threads are "
+        "migrated more aggressively (sched_migration_cost_ns=500000)");
+  }
+  std::optional<long> perf_event_paranoid =
+      parse_integer(tunables.perf_event_paranoid);
+  if (perf_event_paranoid.has_value() && perf_event_paranoid.value() > 2) {
+    issues.push_back(
+        "hardware performance counters are not available to unprivileged "
+        "users (kernel.perf_event_paranoid<=2)");
+  }
+  if (tunables.smt_active == "1" && kokkos_uses_smt) {
+    issues.push_back(
+        "Kokkos runs on every SMT sibling, bandwidth bound kernels are usually "
+        "faster with one thread per core");
+  }
+
+  return issues;
+}
+
+std::string check_thread_binding(const std::vector<thread_binding>& bindings,
+                                 const std::vector<numa_node>& nodes) {
+  std::set<int> used_cpus, used_nodes;
+  std::size_t n_migrated = 0, n_unknown = 0;
+  for (const thread_binding& binding : bindings) {
+    if (binding.cpu < 0) {
+      n_unknown++;
+      continue;
+    }
+    used_cpus.insert(binding.cpu);
+    if (binding.numa_node >= 0) {
+      used_nodes.insert(binding.numa_node);
+    }
+    n_migrated += binding.migrated;
+  }
+
+  std::stringstream ss;
+  if (n_unknown == bindings.size()) {
+    ss << "WARNING: the CPU of the host threads cannot be queried";
+    return ss.str();
+  }
+
+  std::size_t n_threads = bindings.size() - n_unknown;
+  std::vector<std::string> issues;
+  if (n_migrated > 0) {
+    issues.push_back(std::to_string(n_migrated) +
+                     " thread(s) migrated between CPUs");
+  }
+  if (used_cpus.size() < n_threads) {
+    issues.push_back(std::to_string(n_threads) + " threads share " +
+                     std::to_string(used_cpus.size()) + " CPU(s)");
+  }
+  // All the threads on a single node while there would be room for them on
+  // the others
+  if (nodes.size() > 1 && used_nodes.size() == 1) {
+    std::size_t node_size = 0;
+    for (const numa_node& node : nodes) {
+      if (static_cast<int>(node.id) == *used_nodes.begin()) {
+        node_size = node.cpus.size();
+      }
+    }
+    if (n_threads >= node_size) {
+      issues.push_back("all threads on NUMA node " +
+                       std::to_string(*used_nodes.begin()));
+    }
+  }
+
+  ss << (issues.empty() ? "OK: " : "WARNING: ");
+  for (const std::string& issue : issues) {
+    ss << issue << ", ";
+  }
+  ss << n_threads << " threads on " << used_cpus.size() << " CPU(s) over "
+     << used_nodes.size() << " NUMA node(s)";
+  return ss.str();
+}
+
+std::vector<std::size_t> make_cpu_placement(
+    const std::vector<cpu_core>& cores,
+    const std::vector<std::vector<std::size_t>>& llc_domains,
+    cpu_placement placement, std::size_t n_threads) {
+  std::vector<std::size_t> cpus;
+
+  switch (placement) {
+    case cpu_placement::one_per_core:
+      for (const cpu_core& core : cores) {
+        cpus.push_back(core.cpus.front());
+      }
+      break;
+
+    case cpu_placement::compact:
+      for (const cpu_core& core : cores) {
+        cpus.insert(cpus.end(), core.cpus.begin(), core.cpus.end());
+      }
+      break;
+
+    case cpu_placement::scatter: {
+      // cores are sorted by socket
+      std::map<std::size_t, std::vector<const cpu_core*>> sockets;
+      std::size_t n_siblings = 0, n_cores = 0;
+      for (const cpu_core& core : cores) {
+        sockets[core.socket].push_back(&core);
+        n_siblings = std::max(n_siblings, core.cpus.size());
+        n_cores    = std::max(n_cores, sockets[core.socket].size());
+      }
+
+      for (std::size_t sibling = 0; sibling < n_siblings; sibling++) {
+        for (std::size_t i = 0; i < n_cores; i++) {
+          for (const auto& [socket, socket_cores] : sockets) {
+            if (i < socket_cores.size() &&
+                sibling < socket_cores[i]->cpus.size()) {
+              cpus.push_back(socket_cores[i]->cpus[sibling]);
+            }
+          }
+        }
+      }
+      break;
+    }
+
+    case cpu_placement::one_per_llc:
+      for (const std::vector<std::size_t>& domain : llc_domains) {
+        cpus.push_back(domain.front());
+      }
+      break;
+  }
+
+  if (n_threads != 0 && n_threads < cpus.size()) {
+    cpus.resize(n_threads);
+  }
+  return cpus;
+}
+
+team_policy_hint suggest_team_policy(
+    const std::vector<thread_binding>& bindings,
+    const std::vector<std::vector<std::size_t>>& llc_domains,
+    std::size_t n_work_items) {
+  auto find_domain = [&](int cpu) -> int {
+    for (std::size_t i = 0; i < llc_domains.size(); i++) {
+      if (std::binary_search(llc_domains[i].begin(), llc_domains[i].end(),
+                             static_cast<std::size_t>(cpu))) {
+        return i;
+      }
+    }
+    return -1;
+  };
+
+  // The host backends build a team from consecutive thread ids, so the team
+  // size has to divide the length of every run of consecutive threads bound
+  // in the same domain. Unbound or unknown threads make runs of length 1
+  std::size_t team_size = 0, run = 0;
+  int run_domain        = -1;
+  for (const thread_binding& binding : bindings) {
+    int domain = binding.migrated ? -1 : find_domain(binding.cpu);
+    if (run > 0 && domain >= 0 && domain == run_domain) {
+      run++;
+      continue;
+    }
+    if (run > 0) {
+      team_size = std::gcd(team_size, run);
+    }
+    run        = 1;
+    run_domain = domain;
+  }
+  team_size = std::max<std::size_t>(std::gcd(team_size, run), 1);
+
+  team_policy_hint hint;
+  hint.team_size   = team_size;
+  hint.league_size = std::max<std::size_t>(bindings.size() / team_size, 1);
+  hint.chunk_size  = (n_work_items + hint.league_size - 1) / hint.league_size;
+  return hint;
+}
+
+}  // namespace impl
+
+std::string check_cpu_frequency_scaling() {
+  return impl::check_cpu_frequencies(get_cpu_frequencies(),
+                                     get_cpu_boost_state());
+}
+
+std::vector<std::string> lint_host_performance() {
+  // The counts are -1 when the topology is unknown
+  constexpr std::size_t unknown  = static_cast<std::size_t>(-1);
+  const std::size_t n_sockets    = get_physical_socket_count();
+  const std::size_t n_per_socket = get_core_count_per_socket();
+  const std::size_t concurrency =
+      Kokkos::DefaultHostExecutionSpace().concurrency();
+  const bool kokkos_uses_smt = n_sockets != unknown &&
+                               n_per_socket != unknown &&
+                               concurrency > n_sockets * n_per_socket;
+
+  return impl::lint_host_performance(get_kernel_tunables(),
+                                     get_numa_nodes().size(), kokkos_uses_smt);
+}
+
+std::string check_kokkos_thread_binding() {
+  return impl::check_thread_binding(get_kokkos_thread_binding(),
+                                    get_numa_nodes());
+}
+
+std::vector<std::size_t> get_cpu_placement(cpu_placement placement,
+                                           std::size_t n_threads) {
+  return impl::make_cpu_placement(get_cpu_cores(), get_llc_domains(),
+                                  placement, n_threads);
+}
+
+team_policy_hint suggest_team_policy(std::size_t n_work_items) {
+  return impl::suggest_team_policy(get_kokkos_thread_binding(),
+                                   get_llc_domains(), n_work_items);
+}
+
+std::string format_omp_places(const std::vector<std::size_t>& cpus) {
+  std::string places;
+  for (std::size_t i = 0; i < cpus.size(); i++) {
+    places += (i == 0 ? "{" : ",{") + std::to_string(cpus[i]) + "}";
+  }
+  return places;
+}
+
 #if defined(KOKKOS_ENABLE_HIP)
 
 std::string get_gpu_name() {
@@ -187,14 +1122,191 @@ void print_host_info(std::ostream& ostream) {
           << "- Cores per socket: " << get_core_count_per_socket() << '\n'
           << "- Threads per socket: " << get_thread_count_per_socket() << '\n'
           << "- Sockets: " << get_physical_socket_count() << '\n'
-          << "- Kokkos Concurrency: " << get_kokkos_concurrency() << std::endl;
+          << "- Microcode: " << get_cpu_microcode_version() << '\n'
+          << "- Kokkos Concurrency: " << get_kokkos_concurrency() << '\n';
+
+  // ARM Neoverse-V2 r0p0 (MIDR 0x410fd4f0), SVE2 128 bits
+  std::optional<arm_cpu_info> arm = get_arm_cpu_info();
+  if (arm.has_value()) {
+    ostream << "- Arm: " << arm->vendor << ' ' << arm->part_name << " r"
+            << arm->variant << 'p' << arm->revision << " (MIDR 0x" << std::hex
+            << arm->midr << std::dec << "), ";
+    if (arm->sve) {
+      ostream << (arm->sve2 ? "SVE2 " : "SVE ") << arm->sve_vector_length
+              << " bits\n";
+    } else {
+      ostream << "no SVE\n";
+    }
+  }
+
+  // L1d 48 KiB, L1i 32 KiB, L2 2048 KiB, ...
+  ostream << "- Caches:";
+  std::vector<cache_info> caches = get_cpu_caches();
+  for (std::size_t i = 0; i < caches.size(); i++) {
+    const cache_info& cache = caches[i];
+    ostream << (i == 0 ? " L" : ", L") << cache.level
+            << (cache.type == "Data"          ? "d"
+                : cache.type == "Instruction" ? "i"
+                                              : "")
+            << ' ' << cache.size / 1024 << " KiB";
+  }
+  ostream << '\n';
+
+  // Frequencies are summarized over all the CPUs, with the number of CPUs
+  // using each setting
+  std::vector<cpu_frequency> frequencies = get_cpu_frequencies();
+  if (frequencies.empty()) {
+    ostream << "- Frequency: N/A\n";
+  } else {
+    double min_current = frequencies[0].current, max_current = 0.;
+    double min = frequencies[0].min, max = 0.;
+    std::map<std::string, std::size_t> governors, epps;
+    for (const cpu_frequency& frequency : frequencies) {
+      min_current = std::min(min_current, frequency.current);
+      max_current = std::max(max_current, frequency.current);
+      min         = std::min(min, frequency.min);
+      max         = std::max(max, frequency.max);
+      if (!frequency.governor.empty()) {
+        governors[frequency.governor]++;
+      }
+      if (!frequency.energy_performance_preference.empty()) {
+        epps[frequency.energy_performance_preference]++;
+      }
+    }
+
+    auto print_counts = [&](const std::map<std::string, std::size_t>& counts) {
+      bool first = true;
+      for (const auto& [value, n_cpus] : counts) {
+        ostream << (first ? " " : ", ") << value << " (" << n_cpus << ")";
+        first = false;
+      }
+      ostream << '\n';
+    };
+
+    ostream << "- Frequency: " << min_current << "-" << max_current
+            << " MHz (range " << min << "-" << max << " MHz)\n";
+    if (!governors.empty()) {
+      ostream << "- Governor:";
+      print_counts(governors);
+    }
+    if (!epps.empty()) {
+      ostream << "- Energy performance preference:";
+      print_counts(epps);
+    }
+  }
+  std::string boost_state = get_cpu_boost_state();
+  ostream << "- Boost: " << boost_state << '\n'
+          << "- Frequency check: "
+          << impl::check_cpu_frequencies(frequencies, boost_state) << '\n';
+
+  // Slots, types and speeds of the populated slots, e.g. "16 of 16 slots
+  // populated (DDR5 4800 MT/s)"
+  memory_info memory = get_memory_info();
+  std::set<std::string> memory_types;
+  for (const memory_device& device : memory.devices) {
+    if (device.size != 0) {
+      memory_types.insert((device.type.empty() ? "" : device.type + " ") +
+                          std::to_string(device.speed) + " MT/s");
+    }
+  }
+  ostream << "- Memory: ";
+  if (memory.devices.empty()) {
+    ostream << "N/A";
+  } else {
+    ostream << memory.populated_slots << " of " << memory.devices.size()
+            << " slots populated (";
+    for (const std::string& memory_type : memory_types) {
+      ostream << (memory_type == *memory_types.begin() ? "" : ", ")
+              << memory_type;
+    }
+    ostream << ')';
+  }
+  ostream << ", theoretical bandwidth ";
+  if (memory.theoretical_bandwidth > 0.) {
+    ostream << memory.theoretical_bandwidth << " GB/s";
+  } else {
+    ostream << "N/A";
+  }
+  ostream << " (source: " << memory.source << ")\n";
+
+  timer_info timer = get_timer_info();
+  ostream << "- Timer: " << timer.clocksource
+          << " (invariant TSC: " << timer.invariant_tsc << "), overhead "
+          << timer.overhead << " ns, granularity " << timer.granularity
+          << " ns, min duration " << timer.min_duration << " ns\n";
+
+  ostream << "- Physical cores: " << get_cpu_cores().size()
+          << " (one thread per core: CPUs "
+          << impl::format_cpu_list(
+                 get_cpu_placement(cpu_placement::one_per_core))
+          << ")\n";
+
+  // Sizes of the last level cache domains and clusters, e.g. "16 x 16 CPUs"
+  auto print_cpu_groups = [&](const char* name, const auto& groups) {
+    std::map<std::size_t, std::size_t> group_sizes;
+    for (const std::vector<std::size_t>& group : groups) {
+      group_sizes[group.size()]++;
+    }
+    ostream << "- " << name << ':';
+    for (const auto& [size, count] : group_sizes) {
+      ostream << ' ' << count << " x " << size << " CPUs";
+    }
+    ostream << (group_sizes.empty() ? " N/A\n" : "\n");
+  };
+  print_cpu_groups("LLC domains", get_llc_domains());
+  print_cpu_groups("Clusters", get_cpu_clusters());
+
+  std::vector<numa_node> nodes = get_numa_nodes();
+  ostream << "- NUMA nodes: " << nodes.size() << '\n';
+  for (const numa_node& node : nodes) {
+    ostream << "  - Node " << node.id << ": CPUs "
+            << impl::format_cpu_list(node.cpus) << " (distances:";
+    for (std::size_t distance : node.distances) {
+      ostream << ' ' << distance;
+    }
+    ostream << ")\n";
+  }
+
+  // thread:cpu/node, migrated threads are marked with a '*'
+  std::vector<thread_binding> bindings = get_kokkos_thread_binding();
+  ostream << "- Thread binding:";
+  for (const thread_binding& binding : bindings) {
+    ostream << ' ' << binding.thread_id << ':' << binding.cpu << '/'
+            << binding.numa_node << (binding.migrated ? "*" : "");
+  }
+  team_policy_hint hint =
+      impl::suggest_team_policy(bindings, get_llc_domains(), 0);
+  ostream << '\n'
+          << "- Binding check: " << impl::check_thread_binding(bindings, nodes)
+          << '\n'
+          << "- Team policy hint: team size " << hint.team_size << ", league "
+          << hint.league_size << std::endl;
 }
 
 void print_os_info(std::ostream& ostream) {
   ostream << "OS:\n"
           << "- Type: " << get_sys_type() << '\n'
           << "- Name: " << get_sys_name() << '\n'
-          << "- Kernel: " << get_kernel_version() << std::endl;
+          << "- Kernel: " << get_kernel_version() << '\n';
+
+  kernel_tunables tunables = get_kernel_tunables();
+  ostream << "- NUMA balancing: " << tunables.numa_balancing << '\n'
+          << "- Zone reclaim mode: " << tunables.zone_reclaim_mode << '\n'
+          << "- Overcommit memory: " << tunables.overcommit_memory << '\n'
+          << "- Sched migration cost (ns): "
+          << tunables.sched_migration_cost_ns << '\n'
+          << "- Sched nr migrate: " << tunables.sched_nr_migrate << '\n'
+          << "- Transparent huge pages: " << tunables.transparent_hugepage
+          << '\n'
+          << "- Perf event paranoid: " << tunables.perf_event_paranoid << '\n'
+          << "- SMT active: " << tunables.smt_active << '\n';
+
+  std::vector<std::string> issues = lint_host_performance();
+  ostream << "- Performance lint:" << (issues.empty() ? " OK" : "");
+  for (const std::string& issue : issues) {
+    ostream << "\n  - WARNING: " << issue;
+  }
+  ostream << std::endl;
 }
 
 void print_device_info(std::ostream& ostream) {
@@ -4,9 +4,14 @@
 #ifndef CEXA_ARCHINFO_HPP
 #define CEXA_ARCHINFO_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
 #include <string>
 #include <ostream>
 #include <iostream>
+#include <vector>
 
 namespace cexa {
 
@@ -17,21 +22,298 @@ std::string get_cpu_model_name();
 std::size_t get_physical_socket_count();
 std::size_t get_core_count_per_socket();
 std::size_t get_thread_count_per_socket();
+std::string get_cpu_microcode_version();
+// Instruction set extensions of the CPU, as named by Linux in /proc/cpuinfo
+// (e.g. "avx2", "avx512f", "asimd", "sve")
+std::vector<std::string> get_cpu_features();
+
+// Arm identification, decoded from the Main ID Register (MIDR_EL1)
+struct arm_cpu_info {
+  std::uint32_t midr        = 0;
+  std::uint32_t implementer = 0;
+  std::uint32_t variant     = 0;
+  std::uint32_t part        = 0;
+  std::uint32_t revision    = 0;
+  // "ARM", "Fujitsu", ... and "Neoverse-V2", "A64FX", ..., "Unknown" if the
+  // implementer or part is not in the tables
+  std::string vendor;
+  std::string part_name;
+  bool sve  = false;
+  bool sve2 = false;
+  // SVE vector length of the calling thread in bits, 0 without SVE
+  std::size_t sve_vector_length = 0;
+};
+
+// nullopt on other architectures, or if the MIDR can not be read
+std::optional<arm_cpu_info> get_arm_cpu_info();
+
+struct cache_info {
+  std::size_t level;
+  std::string type;  // "Data", "Instruction" or "Unified"
+  std::size_t size;  // in bytes
+  std::size_t line_size;
+  // CPUs sharing this cache with the first CPU, empty if unknown
+  std::vector<std::size_t> shared_cpus;
+};
+
+// Caches seen by the first CPU, sorted by level
+std::vector<cache_info> get_cpu_caches();
+
+// SMT
+struct cpu_core {
+  std::size_t socket;
+  std::size_t id;  // unique within a socket only
+  // Logical CPUs of this core (its SMT siblings), sorted
+  std::vector<std::size_t> cpus;
+};
+
+// Physical cores sorted by socket, then by first logical CPU
+std::vector<cpu_core> get_cpu_cores();
+// Logical CPUs the calling process may run on (its affinity mask), sorted.
+// Empty if unknown
+std::vector<std::size_t> get_process_cpus();
+
+// Groups of logical CPUs sharing a last level cache (e.g. the L3 of a CCX on
+// AMD EPYC), sorted by first CPU. Empty if unknown
+std::vector<std::vector<std::size_t>> get_llc_domains();
+// Groups of logical CPUs of a same cluster (topology/cluster_id, e.g. the cores
+// sharing an L2 on some Arm and Intel CPUs), sorted by first CPU. Empty if
+// unknown
+std::vector<std::vector<std::size_t>> get_cpu_clusters();
+
+// TeamPolicy decomposition for the Kokkos host backends in which no team spans
+// two last level cache domains, given the current binding of the host threads
+struct team_policy_hint {
+  std::size_t team_size;
+  // One team per team_size threads, all the teams run concurrently
+  std::size_t league_size;
+  // Work items per team to split n_work_items in contiguous blocks
+  std::size_t chunk_size;
+};
+
+team_policy_hint suggest_team_policy(std::size_t n_work_items);
+
+enum class cpu_placement {
+  one_per_core,  // first SMT sibling of every core
+  compact,       // every logical CPU, filling the siblings of a core first
+  scatter,       // every logical CPU, round robin across the sockets and
+                 // filling the first sibling of every core first
+  one_per_llc,   // first CPU of every last level cache domain
+};
+
+// Ordered list of logical CPUs, one per thread, for the given placement.
+// Truncated to n_threads if it is not 0. The i-th thread should be bound to
+// the i-th CPU, e.g. with pthread_setaffinity_np
+std::vector<std::size_t> get_cpu_placement(cpu_placement placement,
+                                           std::size_t n_threads = 0);
+// The same list formatted for OMP_PLACES: "{0},{2},{4}"
+std::string format_omp_places(const std::vector<std::size_t>& cpus);
+
+// CPU frequency scaling
+struct cpu_frequency {
+  std::size_t cpu;
+  // In MHz, 0 if unknown
+  double current      = 0.;
+  double min          = 0.;
+  double max          = 0.;
+  double hardware_max = 0.;
+  std::string governor;
+  std::string energy_performance_preference;
+};
+
+std::vector<cpu_frequency> get_cpu_frequencies();
+// "enabled", "disabled" or "N/A"
+std::string get_cpu_boost_state();
+// One line diagnostic of the frequency scaling configuration, starting with
+// either "OK" or "WARNING"
+std::string check_cpu_frequency_scaling();
+
+// NUMA
+struct numa_node {
+  std::size_t id;
+  std::vector<std::size_t> cpus;
+  // Distance to every other node, indexed by position in get_numa_nodes()
+  std::vector<std::size_t> distances;
+};
+
+struct thread_binding {
+  std::size_t thread_id;
+  // CPU the thread was seen on in the last sampling round, -1 if it could not
+  // be sampled
+  int cpu       = -1;
+  int numa_node = -1;  // -1 if it could not be determined
+  // The thread was seen running on more than one CPU while sampling
+  bool migrated = false;
+};
+
+std::vector<numa_node> get_numa_nodes();
+std::vector<thread_binding> get_kokkos_thread_binding();
+// One line diagnostic of the host thread binding, starting with either "OK" or
+// "WARNING"
+std::string check_kokkos_thread_binding();
+
+// Memory
+struct memory_device {
+  std::string locator;  // e.g. "DIMM_A1"
+  std::string type;     // e.g. "DDR5", empty if unknown
+  // In bytes, 0 for an empty slot
+  std::size_t size = 0;
+  // Configured speed in MT/s, and width in bits, 0 if unknown
+  std::size_t speed      = 0;
+  std::size_t data_width = 0;
+};
+
+struct memory_info {
+  // Every memory slot, populated or not
+  std::vector<memory_device> devices;
+  std::size_t populated_slots = 0;
+  // Peak DRAM bandwidth in GB/s, 0 if unknown
+  double theoretical_bandwidth = 0.;
+  // "SMBIOS", "EDAC", "CEXA_DRAM_BANDWIDTH" or "N/A"
+  std::string source = "N/A";
+};
+
+// Memory slots from the SMBIOS tables (readable by root only on most Linux
+// systems) or EDAC. The theoretical bandwidth assumes one DIMM per channel, it
+// can be overridden with the CEXA_DRAM_BANDWIDTH environment variable (GB/s)
+memory_info get_memory_info();
+// One line diagnostic comparing a measured DRAM bandwidth (GB/s) to the
+// theoretical one and flagging empty slots, starting with "OK", "WARNING" or
+// "N/A"
+std::string check_memory_bandwidth(double measured_bandwidth);
+
+// Timers
+struct timer_info {
+  // Kernel clock source backing steady_clock, e.g. "tsc" or "hpet"
+  std::string clocksource;
+  // "yes", "no", or "N/A" on non x86 CPUs
+  std::string invariant_tsc;
+  // Cost of one Kokkos::Timer::seconds() call, in ns
+  double overhead = 0.;
+  // Smallest non zero difference between two reads, in ns
+  double granularity = 0.;
+  // Shortest duration timed with an error below 1%, in ns
+  double min_duration = 0.;
+};
+
+// Measured on the first call, which takes a few milliseconds
+timer_info get_timer_info();
+// Number of back to back runs of a kernel lasting duration seconds to time
+// together for the measurement to be reliable
+std::size_t get_timer_repetitions(double duration);
+
+namespace impl {
+
+// Best time of a few launches of a kernel, in seconds, the first one being a
+// warm up. Fences after each launch
+double time_launches(const std::function<void()>& launch);
+
+}  // namespace impl
 
 // OS
 std::string get_sys_name();
 std::string get_sys_type();
 std::string get_kernel_version();
 
+// Kernel settings affecting the performance of HPC applications, "N/A" when
+// not available on this system
+struct kernel_tunables {
+  std::string numa_balancing;
+  std::string zone_reclaim_mode;
+  std::string overcommit_memory;
+  std::string sched_migration_cost_ns;
+  std::string sched_nr_migrate;
+  std::string transparent_hugepage;
+  std::string perf_event_paranoid;
+  std::string smt_active;
+};
+
+kernel_tunables get_kernel_tunables();
+// Known bad combinations of system settings for the Kokkos host backends, one
+// message per issue. Empty if nothing was found
+std::vector<std::string> lint_host_performance();
+
 // GPU
 std::string get_gpu_name();
 std::string get_gpu_arch();
 std::string get_gpu_driver_version();
 std::string get_gpu_runtime_version();
 
+// Kokkos
+struct kokkos_config {
+  std::string version;
+  // Enabled backends, e.g. "Serial", "OpenMP", "CUDA"
+  std::vector<std::string> backends;
+  // Architectures Kokkos was compiled for, without the KOKKOS_ARCH_ prefix
+  std::vector<std::string> archs;
+  // ABI of Kokkos::Experimental::simd<double>, e.g. "avx512_fixed_size<8>"
+  std::string simd_abi;
+  std::size_t simd_width;
+  std::size_t concurrency;
+  std::size_t host_concurrency;
+  // Output of Kokkos::print_configuration
+  std::string configuration;
+};
+
+kokkos_config get_kokkos_config();
+// One line diagnostic comparing the architectures Kokkos was compiled for with
+// the features of the CPU, starting with either "OK" or "WARNING"
+std::string check_kokkos_arch();
+
 void print_os_info(std::ostream& ostream = std::cout);
 void print_host_info(std::ostream& ostream = std::cout);
 void print_device_info(std::ostream& ostream = std::cout);
+void print_kokkos_info(std::ostream& ostream = std::cout);
+
+// Machine readable snapshot of everything above, meant to be attached to
+// benchmark results
+struct arch_report {
+  struct {
+    std::string type;
+    std::string name;
+    std::string kernel;
+    kernel_tunables tunables;
+  } os;
+
+  struct {
+    std::string model;
+    std::string microcode;
+    std::size_t sockets;
+    std::size_t cores_per_socket;
+    std::size_t threads_per_socket;
+    std::vector<cache_info> caches;
+    std::vector<std::vector<std::size_t>> llc_domains;
+    std::vector<numa_node> numa_nodes;
+  } cpu;
+
+  struct {
+    std::string version;
+    std::string execution_space;
+    std::string host_execution_space;
+    std::size_t concurrency;
+    std::vector<std::string> backends;
+    std::vector<std::string> archs;
+    std::string simd_abi;
+    std::string arch_check;
+    std::string thread_binding;
+  } kokkos;
+
+  struct {
+    std::string model;
+    std::string arch;
+    std::string runtime_version;
+    std::string driver_version;
+  } device;
+};
+
+// Only reads files by default, cheap enough to run along every benchmark. With
+// full, also checks the binding of the Kokkos host threads, which launches
+// kernels, and may start lscpu to name the CPU model. The fields that are not
+// collected are left empty
+arch_report get_arch_report(bool full = false);
+
+void write_json(const arch_report& report, std::ostream& ostream = std::cout);
+void write_yaml(const arch_report& report, std::ostream& ostream = std::cout);
 
 }  // namespace cexa
 
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+// Internal helpers shared between the OS specific implementations, this header
+// is not installed.
+
+#ifndef CEXA_ARCHINFO_IMPL_HPP
+#define CEXA_ARCHINFO_IMPL_HPP
+
+#include "cexa_ArchInfo.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cexa::impl {
+
+// Parses a Linux cpu list ("0-3,8,10-11") into a sorted list of cpu ids
+std::vector<std::size_t> parse_cpu_list(const std::string& cpu_list);
+
+// Inverse of parse_cpu_list
+std::string format_cpu_list(std::vector<std::size_t> cpus);
+
+// Parses an integer read from the system (sysctl, caches), surrounding
+// whitespace is ignored. A "0x" prefix is accepted in base 16, and selects
+// base 16 in base 0 (decimal otherwise). Returns nothing for malformed or out
+// of range values instead of throwing
+std::optional<long long> parse_integer(const std::string& value,
+                                       int base = 10);
+
+struct cpu_topology {
+  std::size_t n_sockets          = static_cast<std::size_t>(-1);
+  std::size_t procs_per_socket   = static_cast<std::size_t>(-1);
+  std::size_t threads_per_socket = static_cast<std::size_t>(-1);
+};
+
+// Counts the sockets, cores and threads of a Linux cpu directory
+// (/sys/devices/system/cpu)
+cpu_topology read_cpu_topology(const std::string& cpu_dir);
+
+// Reads the caches of cpu0 from the cache directory of a Linux cpu directory
+std::vector<cache_info> read_cpu_caches(const std::string& cpu_dir);
+
+// Reads the cpufreq settings of every CPU of a Linux cpu directory. The CPUs
+// without cpufreq support (e.g. in VMs) are skipped
+std::vector<cpu_frequency> read_cpu_frequencies(const std::string& cpu_dir);
+
+// Reads the NUMA nodes of a Linux node directory (/sys/devices/system/node).
+// Returns an empty list if the kernel was built without NUMA support
+std::vector<numa_node> read_numa_nodes(const std::string& node_dir);
+
+// Reads the physical cores from the topology directories of a Linux cpu
+// directory (/sys/devices/system/cpu)
+std::vector<cpu_core> read_cpu_cores(const std::string& cpu_dir);
+
+// Reads the last level cache domains from the cache directories of a Linux
+// cpu directory
+std::vector<std::vector<std::size_t>> read_llc_domains(
+    const std::string& cpu_dir);
+
+// Reads the clusters from the topology directories of a Linux cpu directory,
+// CPUs without a cluster_id (or with -1) are ignored
+std::vector<std::vector<std::size_t>> read_cpu_clusters(
+    const std::string& cpu_dir);
+
+// MIDR_EL1 of the first CPU of a Linux cpu directory
+// (cpu0/regs/identification/midr_el1)
+std::optional<std::uint32_t> read_midr(const std::string& cpu_dir);
+// MIDR built from the "CPU implementer", "CPU variant", "CPU part" and
+// "CPU revision" fields of /proc/cpuinfo
+std::optional<std::uint32_t> make_midr(const std::string& implementer,
+                                       const std::string& variant,
+                                       const std::string& part,
+                                       const std::string& revision);
+// Fills the identification fields of arm_cpu_info, not the SVE ones
+arm_cpu_info decode_midr(std::uint32_t midr);
+
+std::vector<std::size_t> make_cpu_placement(
+    const std::vector<cpu_core>& cores,
+    const std::vector<std::vector<std::size_t>>& llc_domains,
+    cpu_placement placement, std::size_t n_threads);
+
+team_policy_hint suggest_team_policy(
+    const std::vector<thread_binding>& bindings,
+    const std::vector<std::vector<std::size_t>>& llc_domains,
+    std::size_t n_work_items);
+
+// $XDG_CACHE_HOME/cexa/<name>, or ~/.cache/cexa/<name>. Empty if neither
+// variable is set
+std::string get_user_cache_file(const std::string& name);
+
+// Snapshot of the system values that do not change until the next boot
+// (/proc/cpuinfo, /etc/os-release, ...), keyed by "<source>/<name>"
+using snapshot_values = std::map<std::string, std::string>;
+
+// Increase it when the content of the snapshot changes so that stale cache
+// files are ignored
+constexpr int snapshot_version = 3;
+
+// Reads "key<sep>value" lines into values, the keys prefixed with prefix. The
+// keys and values are trimmed and the "#" comments skipped. With
+// first_block_only, stops at the first empty line (the first processor of
+// /proc/cpuinfo)
+void read_key_values(std::istream& stream, char separator,
+                     const std::string& prefix, bool first_block_only,
+                     snapshot_values& values);
+
+// Writes to a unique temporary file then renames it, so that concurrent
+// processes never read a partial file
+void write_file_atomically(const std::string& path, const std::string& content);
+
+// Cache files with one "<key>\t<values>" line per entry, shared between the
+// kernels and machines using the same file. The keys are stored escaped, see
+// escape_cache_key, so that any label can be used. Returns the values of key,
+// if any
+// Escapes the backslashes, tabs, newlines and carriage returns of key, which
+// would otherwise split or merge the lines of a cache file
+std::string escape_cache_key(const std::string& key);
+std::optional<std::string> load_cache_entry(const std::string& cache_file,
+                                            const std::string& key);
+// Replaces the entry of key, keeping the other ones
+void save_cache_entry(const std::string& cache_file, const std::string& key,
+                      const std::string& values);
+
+// Cache file of the snapshot, from the CEXA_ARCHINFO_CACHE environment
+// variable: unset, empty, "0" or "OFF" disables the cache, "1" or "ON" selects
+// get_user_cache_file("snapshot.<host_id>"), anything else is a path. host_id
+// is "<hostname>.<boot id>", so that the nodes sharing a home directory, or
+// the containers sharing a boot id, do not overwrite each other's file
+std::string get_snapshot_cache_file(const std::string& host_id);
+// Returns nothing if the file was written by another boot or version
+std::optional<snapshot_values> load_snapshot(const std::string& cache_file,
+                                             const std::string& boot_id);
+void save_snapshot(const std::string& cache_file, const std::string& boot_id,
+                   const snapshot_values& values);
+
+// get_cpu_model_name without starting lscpu, which takes tens of
+// milliseconds. Only differs on Linux, for the Arm parts missing from the MIDR
+// tables
+std::string get_cpu_model_name_without_lscpu();
+
+// Raw SMBIOS structure table, empty if not readable
+std::vector<unsigned char> read_smbios_table();
+// Memory devices (type 17 structures) of an SMBIOS structure table
+std::vector<memory_device> parse_smbios_memory_devices(
+    const std::vector<unsigned char>& table);
+// Memory devices of a Linux EDAC directory (/sys/devices/system/edac/mc), their
+// speed and width are unknown
+std::vector<memory_device> read_edac_memory_devices(
+    const std::string& edac_dir);
+
+// Sums the bandwidth of the populated devices, 0 if one of them has an unknown
+// speed or width
+double get_theoretical_bandwidth(const std::vector<memory_device>& devices);
+
+std::string check_memory_bandwidth(const memory_info& info,
+                                   double measured_bandwidth);
+
+std::vector<std::string> get_kokkos_backends();
+std::vector<std::string> get_kokkos_archs();
+std::string get_simd_abi();
+// Warns when Kokkos was compiled for an instruction set the CPU lacks, or when
+// the widest vector extension of the CPU is left unused
+std::string check_kokkos_arch(const std::vector<std::string>& archs,
+                              const std::vector<std::string>& cpu_features);
+
+// Clock source of the OS monotonic clock, "N/A" if unknown
+std::string read_clocksource();
+
+// Duration with a timing error below 1%, given the overhead and granularity
+// of the timer
+double get_min_timer_duration(double overhead, double granularity);
+
+// Logical CPU the calling thread is running on, -1 if unknown
+int get_current_cpu();
+
+std::string check_cpu_frequencies(const std::vector<cpu_frequency>& frequencies,
+                                  const std::string& boost_state);
+
+std::vector<std::string> lint_host_performance(
+    const kernel_tunables& tunables, std::size_t n_numa_nodes,
+    bool kokkos_uses_smt);
+
+std::string check_thread_binding(const std::vector<thread_binding>& bindings,
+                                 const std::vector<numa_node>& nodes);
+
+// Hooks called around every parallel_for, parallel_reduce and parallel_scan,
+// kernel_id is unique among the running kernels
+using kernel_begin_hook = void (*)(const char* label, std::uint64_t kernel_id);
+using kernel_end_hook   = void (*)(std::uint64_t kernel_id);
+
+// The Kokkos profiling callbacks are shared by the hooks of the hardware
+// counters and of the energy measurement. Adding the first hook saves the
+// callbacks already registered (e.g. by a tool loaded through
+// KOKKOS_TOOLS_LIBS), which keep being called, and removing the last one
+// restores them
+void add_kernel_hooks(kernel_begin_hook begin, kernel_end_hook end);
+void remove_kernel_hooks(kernel_begin_hook begin, kernel_end_hook end);
+
+}  // namespace cexa::impl
+
+#endif  // CEXA_ARCHINFO_IMPL_HPP
@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa::impl {
+
+// Double quoted string with the JSON escapes, also a valid YAML scalar
+std::string json_quote(const std::string& str) {
+  std::string quoted = "\"";
+  for (char c : str) {
+    switch (c) {
+      case '"': quoted += "\\\""; break;
+      case '\\': quoted += "\\\\"; break;
+      case '\n': quoted += "\\n"; break;
+      case '\t': quoted += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          quoted += buffer;
+        } else {
+          quoted += c;
+        }
+    }
+  }
+  return quoted + "\"";
+}
+
+// null for the values that were not collected, also a valid YAML scalar
+std::string json_quote_or_null(const std::string& str) {
+  return str.empty() ? "null" : json_quote(str);
+}
+
+// Unknown sizes are reported as -1 by the getters
+std::string json_number(std::size_t value) {
+  return value == static_cast<std::size_t>(-1) ? "null"
+                                               : std::to_string(value);
+}
+
+std::string json_list(const std::vector<std::size_t>& values) {
+  std::string str = "[";
+  for (std::size_t i = 0; i < values.size(); i++) {
+    str += (i == 0 ? "" : ", ") + std::to_string(values[i]);
+  }
+  return str + "]";
+}
+
+std::string json_list(const std::vector<std::string>& values) {
+  std::string str = "[";
+  for (std::size_t i = 0; i < values.size(); i++) {
+    str += (i == 0 ? "" : ", ") + json_quote(values[i]);
+  }
+  return str + "]";
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+arch_report get_arch_report(bool full) {
+  arch_report report;
+
+  report.os.type     = get_sys_type();
+  report.os.name     = get_sys_name();
+  report.os.kernel   = get_kernel_version();
+  report.os.tunables = get_kernel_tunables();
+
+  // Starting lscpu takes tens of milliseconds
+  report.cpu.model = full ? get_cpu_model_name()
+                          : impl::get_cpu_model_name_without_lscpu();
+
+  report.cpu.microcode          = get_cpu_microcode_version();
+  report.cpu.sockets            = get_physical_socket_count();
+  report.cpu.cores_per_socket   = get_core_count_per_socket();
+  report.cpu.threads_per_socket = get_thread_count_per_socket();
+  report.cpu.caches             = get_cpu_caches();
+  report.cpu.llc_domains        = get_llc_domains();
+  report.cpu.numa_nodes         = get_numa_nodes();
+
+  kokkos_config config          = get_kokkos_config();
+  report.kokkos.version         = config.version;
+  report.kokkos.execution_space = Kokkos::DefaultExecutionSpace::name();
+  report.kokkos.host_execution_space =
+      Kokkos::DefaultHostExecutionSpace::name();
+  report.kokkos.concurrency = get_kokkos_concurrency();
+  report.kokkos.backends    = config.backends;
+  report.kokkos.archs       = config.archs;
+  report.kokkos.simd_abi    = config.simd_abi;
+  report.kokkos.arch_check  = check_kokkos_arch();
+  // Launches kernels on the host execution space
+  if (full) {
+    report.kokkos.thread_binding = check_kokkos_thread_binding();
+  }
+
+  report.device.model           = get_gpu_name();
+  report.device.arch            = get_gpu_arch();
+  report.device.runtime_version = get_gpu_runtime_version();
+  report.device.driver_version  = get_gpu_driver_version();
+
+  return report;
+}
+
+void write_json(const arch_report& report, std::ostream& ostream) {
+  using impl::json_list;
+  using impl::json_number;
+  using impl::json_quote;
+  using impl::json_quote_or_null;
+
+  const kernel_tunables& tunables = report.os.tunables;
+  ostream << "{\n"
+          << "  \"os\": {\n"
+          << "    \"type\": " << json_quote(report.os.type) << ",\n"
+          << "    \"name\": " << json_quote(report.os.name) << ",\n"
+          << "    \"kernel\": " << json_quote(report.os.kernel) << ",\n"
+          << "    \"tunables\": {\n"
+          << "      \"numa_balancing\": "
+          << json_quote(tunables.numa_balancing) << ",\n"
+          << "      \"zone_reclaim_mode\": "
+          << json_quote(tunables.zone_reclaim_mode) << ",\n"
+          << "      \"overcommit_memory\": "
+          << json_quote(tunables.overcommit_memory) << ",\n"
+          << "      \"sched_migration_cost_ns\": "
+          << json_quote(tunables.sched_migration_cost_ns) << ",\n"
+          << "      \"sched_nr_migrate\": "
+          << json_quote(tunables.sched_nr_migrate) << ",\n"
+          << "      \"transparent_hugepage\": "
+          << json_quote(tunables.transparent_hugepage) << ",\n"
+          << "      \"perf_event_paranoid\": "
+          << json_quote(tunables.perf_event_paranoid) << ",\n"
+          << "      \"smt_active\": " << json_quote(tunables.smt_active)
+          << "\n"
+          << "    }\n"
+          << "  },\n";
+
+  ostream << "  \"cpu\": {\n"
+          << "    \"model\": " << json_quote(report.cpu.model) << ",\n"
+          << "    \"microcode\": " << json_quote(report.cpu.microcode) << ",\n"
+          << "    \"sockets\": " << json_number(report.cpu.sockets) << ",\n"
+          << "    \"cores_per_socket\": "
+          << json_number(report.cpu.cores_per_socket) << ",\n"
+          << "    \"threads_per_socket\": "
+          << json_number(report.cpu.threads_per_socket) << ",\n"
+          << "    \"caches\": [";
+  for (std::size_t i = 0; i < report.cpu.caches.size(); i++) {
+    const cache_info& cache = report.cpu.caches[i];
+    ostream << (i == 0 ? "\n" : ",\n") << "      {\"level\": " << cache.level
+            << ", \"type\": " << json_quote(cache.type)
+            << ", \"size\": " << cache.size
+            << ", \"line_size\": " << cache.line_size
+            << ", \"shared_cpus\": " << json_list(cache.shared_cpus) << "}";
+  }
+  ostream << (report.cpu.caches.empty() ? "" : "\n    ") << "],\n"
+          << "    \"llc_domains\": [";
+  for (std::size_t i = 0; i < report.cpu.llc_domains.size(); i++) {
+    ostream << (i == 0 ? "" : ", ") << json_list(report.cpu.llc_domains[i]);
+  }
+  ostream << "],\n"
+          << "    \"numa_nodes\": [";
+  for (std::size_t i = 0; i < report.cpu.numa_nodes.size(); i++) {
+    const numa_node& node = report.cpu.numa_nodes[i];
+    ostream << (i == 0 ? "\n" : ",\n") << "      {\"id\": " << node.id
+            << ", \"cpus\": " << json_list(node.cpus)
+            << ", \"distances\": " << json_list(node.distances) << "}";
+  }
+  ostream << (report.cpu.numa_nodes.empty() ? "" : "\n    ") << "]\n"
+          << "  },\n";
+
+  ostream << "  \"kokkos\": {\n"
+          << "    \"version\": " << json_quote(report.kokkos.version) << ",\n"
+          << "    \"execution_space\": "
+          << json_quote(report.kokkos.execution_space) << ",\n"
+          << "    \"host_execution_space\": "
+          << json_quote(report.kokkos.host_execution_space) << ",\n"
+          << "    \"concurrency\": " << json_number(report.kokkos.concurrency)
+          << ",\n"
+          << "    \"backends\": " << json_list(report.kokkos.backends) << ",\n"
+          << "    \"archs\": " << json_list(report.kokkos.archs) << ",\n"
+          << "    \"simd_abi\": " << json_quote(report.kokkos.simd_abi) << ",\n"
+          << "    \"arch_check\": " << json_quote(report.kokkos.arch_check)
+          << ",\n"
+          << "    \"thread_binding\": "
+          << json_quote_or_null(report.kokkos.thread_binding) << "\n"
+          << "  },\n";
+
+  ostream << "  \"device\": {\n"
+          << "    \"model\": " << json_quote(report.device.model) << ",\n"
+          << "    \"arch\": " << json_quote(report.device.arch) << ",\n"
+          << "    \"runtime_version\": "
+          << json_quote(report.device.runtime_version) << ",\n"
+          << "    \"driver_version\": "
+          << json_quote(report.device.driver_version) << "\n"
+          << "  }\n"
+          << "}" << std::endl;
+}
+
+void write_yaml(const arch_report& report, std::ostream& ostream) {
+  using impl::json_list;
+  using impl::json_number;
+  using impl::json_quote;
+  using impl::json_quote_or_null;
+
+  const kernel_tunables& tunables = report.os.tunables;
+  ostream << "os:\n"
+          << "  type: " << json_quote(report.os.type) << '\n'
+          << "  name: " << json_quote(report.os.name) << '\n'
+          << "  kernel: " << json_quote(report.os.kernel) << '\n'
+          << "  tunables:\n"
+          << "    numa_balancing: " << json_quote(tunables.numa_balancing)
+          << '\n'
+          << "    zone_reclaim_mode: " << json_quote(tunables.zone_reclaim_mode)
+          << '\n'
+          << "    overcommit_memory: " << json_quote(tunables.overcommit_memory)
+          << '\n'
+          << "    sched_migration_cost_ns: "
+          << json_quote(tunables.sched_migration_cost_ns) << '\n'
+          << "    sched_nr_migrate: " << json_quote(tunables.sched_nr_migrate)
+          << '\n'
+          << "    transparent_hugepage: "
+          << json_quote(tunables.transparent_hugepage) << '\n'
+          << "    perf_event_paranoid: "
+          << json_quote(tunables.perf_event_paranoid) << '\n'
+          << "    smt_active: " << json_quote(tunables.smt_active) << '\n';
+
+  ostream << "cpu:\n"
+          << "  model: " << json_quote(report.cpu.model) << '\n'
+          << "  microcode: " << json_quote(report.cpu.microcode) << '\n'
+          << "  sockets: " << json_number(report.cpu.sockets) << '\n'
+          << "  cores_per_socket: " << json_number(report.cpu.cores_per_socket)
+          << '\n'
+          << "  threads_per_socket: "
+          << json_number(report.cpu.threads_per_socket) << '\n'
+          << "  caches:" << (report.cpu.caches.empty() ? " []\n" : "\n");
+  for (const cache_info& cache : report.cpu.caches) {
+    ostream << "    - level: " << cache.level << '\n'
+            << "      type: " << json_quote(cache.type) << '\n'
+            << "      size: " << cache.size << '\n'
+            << "      line_size: " << cache.line_size << '\n'
+            << "      shared_cpus: " << json_list(cache.shared_cpus) << '\n';
+  }
+  ostream << "  llc_domains:"
+          << (report.cpu.llc_domains.empty() ? " []\n" : "\n");
+  for (const std::vector<std::size_t>& domain : report.cpu.llc_domains) {
+    ostream << "    - " << json_list(domain) << '\n';
+  }
+  ostream << "  numa_nodes:"
+          << (report.cpu.numa_nodes.empty() ? " []\n" : "\n");
+  for (const numa_node& node : report.cpu.numa_nodes) {
+    ostream << "    - id: " << node.id << '\n'
+            << "      cpus: " << json_list(node.cpus) << '\n'
+            << "      distances: " << json_list(node.distances) << '\n';
+  }
+
+  ostream << "kokkos:\n"
+          << "  version: " << json_quote(report.kokkos.version) << '\n'
+          << "  execution_space: " << json_quote(report.kokkos.execution_space)
+          << '\n'
+          << "  host_execution_space: "
+          << json_quote(report.kokkos.host_execution_space) << '\n'
+          << "  concurrency: " << json_number(report.kokkos.concurrency) << '\n'
+          << "  backends: " << json_list(report.kokkos.backends) << '\n'
+          << "  archs: " << json_list(report.kokkos.archs) << '\n'
+          << "  simd_abi: " << json_quote(report.kokkos.simd_abi) << '\n'
+          << "  arch_check: " << json_quote(report.kokkos.arch_check) << '\n'
+          << "  thread_binding: "
+          << json_quote_or_null(report.kokkos.thread_binding)
+          << '\n';
+
+  ostream << "device:\n"
+          << "  model: " << json_quote(report.device.model) << '\n'
+          << "  arch: " << json_quote(report.device.arch) << '\n'
+          << "  runtime_version: " << json_quote(report.device.runtime_version)
+          << '\n'
+          << "  driver_version: " << json_quote(report.device.driver_version)
+          << std::endl;
+}
+
+}  // namespace cexa
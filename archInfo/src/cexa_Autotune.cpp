@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_Autotune.hpp"
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cexa::impl {
+
+std::string get_autotune_cache_key(const std::string& label,
+                                   const std::string& execution_space,
+                                   std::size_t concurrency) {
+  return get_cpu_model_name() + "|" + std::to_string(get_cpu_cores().size()) +
+         "|" + execution_space + "|" + std::to_string(concurrency) + "|" +
+         label + "|v" + std::to_string(autotune_version);
+}
+
+std::string get_default_autotune_cache_file() {
+  return get_user_cache_file("autotune");
+}
+
+// The cache entries are "<team size> <vector length> <chunk size> <time>"
+std::optional<autotune_result> load_autotune(const std::string& cache_file,
+                                             const std::string& key) {
+  std::optional<std::string> entry = load_cache_entry(cache_file, key);
+  if (!entry.has_value()) {
+    return std::nullopt;
+  }
+
+  autotune_result result;
+  std::stringstream values(entry.value());
+  if (values >> result.team_size >> result.vector_length >>
+      result.chunk_size >> result.time) {
+    return result;
+  }
+  return std::nullopt;
+}
+
+void save_autotune(const std::string& cache_file, const std::string& key,
+                   const autotune_result& result) {
+  std::stringstream values;
+  values << result.team_size << ' ' << result.vector_length << ' '
+         << result.chunk_size << ' ' << result.time;
+  save_cache_entry(cache_file, key, values.str());
+}
+
+std::vector<int> get_team_size_candidates(int team_size_max) {
+  std::vector<int> candidates;
+  for (int team_size = 1; team_size <= team_size_max; team_size *= 2) {
+    candidates.push_back(team_size);
+  }
+
+  // Teams staying inside a last level cache domain are usually the fastest
+  int llc_team_size = static_cast<int>(cexa::suggest_team_policy(0).team_size);
+  if (llc_team_size <= team_size_max &&
+      std::find(candidates.begin(), candidates.end(), llc_team_size) ==
+          candidates.end()) {
+    candidates.push_back(llc_team_size);
+  }
+
+  if (candidates.empty()) {
+    candidates.push_back(1);
+  }
+  return candidates;
+}
+
+std::vector<int> get_vector_length_candidates(int vector_length_max) {
+  std::vector<int> candidates;
+  for (int vector_length = 1;
+       vector_length <= std::min(vector_length_max, 8); vector_length *= 2) {
+    candidates.push_back(vector_length);
+  }
+
+  if (candidates.empty()) {
+    candidates.push_back(1);
+  }
+  return candidates;
+}
+
+std::vector<std::size_t> get_chunk_size_candidates(std::size_t n,
+                                                   std::size_t concurrency) {
+  std::vector<std::size_t> candidates = {0};
+  const std::size_t share = n / std::max<std::size_t>(concurrency, 1);
+  for (std::size_t chunk_size = 1; chunk_size <= share; chunk_size *= 4) {
+    candidates.push_back(chunk_size);
+  }
+  return candidates;
+}
+
+}  // namespace cexa::impl
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_AUTOTUNE_HPP
+#define CEXA_AUTOTUNE_HPP
+
+#include "cexa_ArchInfo.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Best launch parameters found for a kernel, 0 for the parameters that were
+// not tuned
+struct autotune_result {
+  int team_size          = 0;
+  int vector_length      = 0;
+  std::size_t chunk_size = 0;
+  // Time of one launch with these parameters, in seconds
+  double time = 0.;
+  // The parameters were read from the cache file, no search was done
+  bool from_cache = false;
+};
+
+namespace impl {
+
+// Increase it when the search changes so that stale cached results are ignored
+constexpr int autotune_version = 1;
+
+// Cache entries are keyed by CPU model, number of cores, execution space and
+// its concurrency, and kernel label
+std::string get_autotune_cache_key(const std::string& label,
+                                   const std::string& execution_space,
+                                   std::size_t concurrency);
+// $XDG_CACHE_HOME/cexa/autotune, or ~/.cache/cexa/autotune. Empty if neither
+// variable is set
+std::string get_default_autotune_cache_file();
+std::optional<autotune_result> load_autotune(const std::string& cache_file,
+                                             const std::string& key);
+void save_autotune(const std::string& cache_file, const std::string& key,
+                   const autotune_result& result);
+
+// Power of two team sizes up to team_size_max, and the team size aligned to
+// the last level cache domains
+std::vector<int> get_team_size_candidates(int team_size_max);
+// Power of two vector lengths up to vector_length_max, at most 8
+std::vector<int> get_vector_length_candidates(int vector_length_max);
+// 0 (the Kokkos default) and powers of 4 up to the size of a per thread share
+// of n
+std::vector<std::size_t> get_chunk_size_candidates(std::size_t n,
+                                                   std::size_t concurrency);
+
+template <class ExecSpace, class Search>
+autotune_result autotune(const std::string& label,
+                         const std::string& cache_file, const Search& search) {
+  const std::string key = get_autotune_cache_key(label, ExecSpace::name(),
+                                                 ExecSpace().concurrency());
+  if (!cache_file.empty()) {
+    std::optional<autotune_result> cached = load_autotune(cache_file, key);
+    if (cached.has_value()) {
+      cached->from_cache = true;
+      return cached.value();
+    }
+  }
+
+  autotune_result result = search();
+  if (!cache_file.empty()) {
+    save_autotune(cache_file, key, result);
+  }
+  return result;
+}
+
+}  // namespace impl
+
+// Runs functor on the default host execution space with a
+// TeamPolicy(league_size, team_size, vector_length) for every candidate
+// (team_size, vector_length), and returns the fastest. The result is cached in
+// cache_file and returned without searching by later runs on the same kind of
+// machine. An empty cache_file disables the cache
+template <class Functor>
+autotune_result autotune_team_policy(
+    const std::string& label, int league_size, const Functor& functor,
+    const std::string& cache_file = impl::get_default_autotune_cache_file()) {
+  using exec_space  = Kokkos::DefaultHostExecutionSpace;
+  using policy_type = Kokkos::TeamPolicy<exec_space>;
+
+  return impl::autotune<exec_space>(label, cache_file, [&]() {
+    const int team_size_max =
+        policy_type(league_size, 1)
+            .team_size_max(functor, Kokkos::ParallelForTag());
+
+    autotune_result best;
+    for (int vector_length : impl::get_vector_length_candidates(
+             policy_type::vector_length_max())) {
+      for (int team_size : impl::get_team_size_candidates(team_size_max)) {
+        double time = impl::time_launches([&]() {
+          Kokkos::parallel_for(
+              label, policy_type(league_size, team_size, vector_length),
+              functor);
+        });
+
+        if (best.team_size == 0 || time < best.time) {
+          best.team_size     = team_size;
+          best.vector_length = vector_length;
+          best.time          = time;
+        }
+      }
+    }
+    return best;
+  });
+}
+
+// Same as autotune_team_policy for the chunk size of a RangePolicy(0, n)
+template <class Functor>
+autotune_result autotune_range_policy(
+    const std::string& label, std::size_t n, const Functor& functor,
+    const std::string& cache_file = impl::get_default_autotune_cache_file()) {
+  using exec_space  = Kokkos::DefaultHostExecutionSpace;
+  using policy_type = Kokkos::RangePolicy<exec_space>;
+
+  return impl::autotune<exec_space>(label, cache_file, [&]() {
+    autotune_result best;
+    bool first = true;
+    for (std::size_t chunk_size :
+         impl::get_chunk_size_candidates(n, exec_space().concurrency())) {
+      double time = impl::time_launches([&]() {
+        policy_type policy(0, n);
+        if (chunk_size != 0) {
+          policy.set_chunk_size(chunk_size);
+        }
+        Kokkos::parallel_for(label, policy, functor);
+      });
+
+      if (first || time < best.time) {
+        best.chunk_size = chunk_size;
+        best.time       = time;
+        first           = false;
+      }
+    }
+    return best;
+  });
+}
+
+}  // namespace cexa
+
+#endif  // CEXA_AUTOTUNE_HPP
@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_Energy.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+double kernel_energy::energy() const { return package_energy + dram_energy; }
+
+double kernel_energy::average_power() const {
+  return time > 0. ? energy() / time : 0.;
+}
+
+}  // namespace cexa
+
+namespace cexa::impl {
+
+std::vector<rapl_domain> read_rapl_domains(const std::string& powercap_dir) {
+  namespace fs = std::filesystem;
+
+  std::vector<rapl_domain> domains;
+  std::error_code ec;
+  for (const fs::directory_entry& entry :
+       fs::directory_iterator(powercap_dir, ec)) {
+    // "intel-rapl:0" (package 0), "intel-rapl:0:1" (its subzones), but not
+    // the "intel-rapl" control type nor "intel-rapl-mmio:0"
+    if (entry.path().filename().string().rfind("intel-rapl:", 0) != 0) {
+      continue;
+    }
+
+    rapl_domain domain;
+    domain.path = entry.path().string();
+    std::ifstream(entry.path() / "name") >> domain.name;
+    std::ifstream(entry.path() / "max_energy_range_uj") >>
+        domain.max_energy_range_uj;
+    if (domain.name.rfind("package", 0) == 0 || domain.name == "dram") {
+      domains.push_back(domain);
+    }
+  }
+
+  std::sort(domains.begin(), domains.end(),
+            [](const rapl_domain& a, const rapl_domain& b) {
+              return a.path < b.path;
+            });
+  return domains;
+}
+
+std::optional<std::uint64_t> read_energy_uj(const rapl_domain& domain) {
+  std::ifstream file(domain.path + "/energy_uj");
+  std::uint64_t energy;
+  if (!(file >> energy)) {
+    return std::nullopt;
+  }
+  return energy;
+}
+
+std::uint64_t get_energy_delta(std::uint64_t begin, std::uint64_t end,
+                               std::uint64_t max_energy_range) {
+  // A counter wrapping more than once (after several minutes at full power)
+  // can not be detected
+  if (end >= begin) {
+    return end - begin;
+  }
+  return max_energy_range >= begin ? max_energy_range - begin + end : end;
+}
+
+using energy_values = std::vector<std::optional<std::uint64_t>>;
+
+struct energy_state {
+  std::mutex mutex;
+  bool started       = false;
+  std::string status = "not started";
+
+  std::vector<rapl_domain> domains;
+
+  struct running_kernel {
+    std::string label;
+    std::chrono::steady_clock::time_point begin;
+    energy_values energies;
+  };
+  std::map<std::uint64_t, running_kernel> running;
+  std::map<std::string, kernel_energy> results;
+};
+
+energy_state& get_energy_state() {
+  static energy_state state;
+  return state;
+}
+
+energy_values read_energies(const energy_state& state) {
+  energy_values energies;
+  for (const rapl_domain& domain : state.domains) {
+    energies.push_back(read_energy_uj(domain));
+  }
+  return energies;
+}
+
+void begin_energy(const char* label, std::uint64_t kernel_id) {
+  energy_state& state = get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  state.running[kernel_id] = {label, std::chrono::steady_clock::now(),
+                              read_energies(state)};
+}
+
+void end_energy(std::uint64_t kernel_id) {
+  energy_state& state = get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  energy_values end   = read_energies(state);
+  const auto end_time = std::chrono::steady_clock::now();
+  auto begin          = state.running.find(kernel_id);
+  if (begin == state.running.end()) {
+    return;
+  }
+
+  const energy_state::running_kernel& kernel = begin->second;
+  kernel_energy& result                      = state.results[kernel.label];
+  result.label                               = kernel.label;
+  result.n_calls++;
+  result.time +=
+      std::chrono::duration<double>(end_time - kernel.begin).count();
+
+  for (std::size_t i = 0; i < state.domains.size(); i++) {
+    if (!kernel.energies[i].has_value() || !end[i].has_value()) {
+      continue;
+    }
+    const double energy =
+        1e-6 * get_energy_delta(kernel.energies[i].value(), end[i].value(),
+                                state.domains[i].max_energy_range_uj);
+    (state.domains[i].name == "dram" ? result.dram_energy
+                                     : result.package_energy) += energy;
+  }
+
+  state.running.erase(begin);
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+bool start_energy_measurement(const std::string& powercap_dir) {
+  impl::energy_state& state = impl::get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.started) {
+    return true;
+  }
+
+  std::vector<impl::rapl_domain> domains =
+      impl::read_rapl_domains(powercap_dir);
+  std::vector<std::string> names;
+  state.domains.clear();
+  for (const impl::rapl_domain& domain : domains) {
+    if (impl::read_energy_uj(domain).has_value()) {
+      state.domains.push_back(domain);
+      names.push_back(domain.name);
+    }
+  }
+
+  if (state.domains.empty()) {
+    state.status =
+        domains.empty()
+            ? "unavailable: no RAPL package or DRAM zone in " + powercap_dir
+            : "unavailable: the energy_uj files of " + powercap_dir +
+                  " are not readable (root only since Linux 5.10)";
+    return false;
+  }
+
+  impl::add_kernel_hooks(impl::begin_energy, impl::end_energy);
+
+  state.started = true;
+  state.status  = "measuring";
+  for (std::size_t i = 0; i < names.size(); i++) {
+    state.status += (i == 0 ? " " : ", ") + names[i];
+  }
+  return true;
+}
+
+void stop_energy_measurement() {
+  impl::energy_state& state = impl::get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (!state.started) {
+    return;
+  }
+
+  impl::remove_kernel_hooks(impl::begin_energy, impl::end_energy);
+
+  state.running.clear();
+  state.started = false;
+  state.status  = "stopped";
+}
+
+std::vector<kernel_energy> get_kernel_energy() {
+  impl::energy_state& state = impl::get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::vector<kernel_energy> results;
+  for (const auto& [label, result] : state.results) {
+    results.push_back(result);
+  }
+  return results;
+}
+
+void reset_kernel_energy() {
+  impl::energy_state& state = impl::get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.results.clear();
+}
+
+std::string get_energy_status() {
+  impl::energy_state& state = impl::get_energy_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.status;
+}
+
+void print_kernel_energy(std::ostream& ostream) {
+  ostream << "KERNEL ENERGY (" << get_energy_status() << "):\n";
+  for (const kernel_energy& result : get_kernel_energy()) {
+    ostream << "- " << result.label << ": " << result.n_calls << " call(s)"
+            << std::fixed << std::setprecision(3) << ", " << result.time
+            << " s, " << result.energy() << " J (package "
+            << result.package_energy << " J, DRAM " << result.dram_energy
+            << " J), " << std::setprecision(1) << result.average_power()
+            << " W" << std::defaultfloat << '\n';
+  }
+  ostream << std::flush;
+}
+
+}  // namespace cexa
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_ENERGY_HPP
+#define CEXA_ENERGY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Energy accumulated over every call of a kernel, summed over the sockets.
+// The RAPL counters cover the whole sockets and memory, including the other
+// processes running on them
+struct kernel_energy {
+  std::string label;
+  std::size_t n_calls = 0;
+  // In seconds
+  double time = 0.;
+  // In joules, dram_energy is 0 if the CPU has no DRAM domain
+  double package_energy = 0.;
+  double dram_energy    = 0.;
+
+  double energy() const;
+  // In watts
+  double average_power() const;
+};
+
+namespace impl {
+
+// A RAPL zone of the powercap tree, e.g. /sys/class/powercap/intel-rapl:0
+struct rapl_domain {
+  // "package-0", "dram", ...
+  std::string name;
+  std::string path;
+  // The energy counter wraps around after this value
+  std::uint64_t max_energy_range_uj = 0;
+};
+
+// Package and DRAM zones of powercap_dir. The intel-rapl-mmio zones, which
+// duplicate the package ones, are skipped
+std::vector<rapl_domain> read_rapl_domains(const std::string& powercap_dir);
+// energy_uj of the domain, nullopt if it can not be read (it is only readable
+// by root on most kernels)
+std::optional<std::uint64_t> read_energy_uj(const rapl_domain& domain);
+// Energy between two reads of a counter, assuming it wrapped at most once
+std::uint64_t get_energy_delta(std::uint64_t begin, std::uint64_t end,
+                               std::uint64_t max_energy_range);
+
+}  // namespace impl
+
+// Reads the RAPL package and DRAM energy counters of powercap_dir and registers
+// Kokkos profiling callbacks accumulating the energy of parallel_for,
+// parallel_reduce and parallel_scan. Returns false, without registering
+// anything, if no counter can be read, see get_energy_status(). Must be called
+// after Kokkos::initialize. It can run along start_kernel_counters and the
+// Kokkos tools, whose callbacks keep being called
+bool start_energy_measurement(
+    const std::string& powercap_dir = "/sys/class/powercap");
+// Unregisters the callbacks, restoring the ones of the Kokkos tools, the
+// accumulated values are kept
+void stop_energy_measurement();
+
+std::vector<kernel_energy> get_kernel_energy();
+void reset_kernel_energy();
+// Why the energy is, or is not, measured
+std::string get_energy_status();
+
+void print_kernel_energy(std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_ENERGY_HPP
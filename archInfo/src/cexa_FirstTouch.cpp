@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_FirstTouch.hpp"
+#include "cexa_ArchInfo.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cexa {
+
+std::vector<int> get_page_numa_nodes(const void* data, std::size_t size) {
+#if defined(__linux__)
+  const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  const std::uintptr_t begin =
+      reinterpret_cast<std::uintptr_t>(data) / page_size * page_size;
+  const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(data) + size;
+
+  std::vector<void*> pages;
+  for (std::uintptr_t page = begin; page < end; page += page_size) {
+    pages.push_back(reinterpret_cast<void*>(page));
+  }
+
+  // Without target nodes, move_pages only queries the node of every page
+  std::vector<int> nodes(pages.size(), -1);
+  if (!pages.empty() && syscall(SYS_move_pages, 0, pages.size(), pages.data(),
+                                nullptr, nodes.data(), 0) != 0) {
+    std::fill(nodes.begin(), nodes.end(), -1);
+  }
+
+  // Unmapped pages are reported with a negative errno
+  for (int& node : nodes) {
+    node = node < 0 ? -1 : node;
+  }
+  return nodes;
+#else
+  (void)data;
+  (void)size;
+  return {};
+#endif
+}
+
+}  // namespace cexa
+
+namespace cexa::impl {
+
+std::string check_page_placement(const std::vector<int>& page_nodes,
+                                 const std::vector<int>& thread_nodes) {
+  if (thread_nodes.empty()) {
+    return "N/A: no Kokkos host thread";
+  }
+
+  std::size_t n_known = 0, n_expected = 0;
+  for (std::size_t page = 0; page < page_nodes.size(); page++) {
+    std::size_t thread = page * thread_nodes.size() / page_nodes.size();
+    if (page_nodes[page] < 0 || thread_nodes[thread] < 0) {
+      continue;
+    }
+
+    n_known++;
+    if (page_nodes[page] == thread_nodes[thread]) {
+      n_expected++;
+    }
+  }
+
+  if (n_known == 0) {
+    return "N/A: the NUMA node of the pages or of the threads is unknown";
+  }
+
+  // Pages shared by two threads at the chunk boundaries may go either way
+  std::stringstream ss;
+  ss << (n_expected >= 0.9 * n_known ? "OK: " : "WARNING: ") << n_expected
+     << " of " << n_known << " page(s) on the NUMA node of their thread";
+  return ss.str();
+}
+
+std::string check_first_touch(const void* data, std::size_t size) {
+  std::vector<int> thread_nodes;
+  for (const thread_binding& binding : get_kokkos_thread_binding()) {
+    thread_nodes.push_back(binding.migrated ? -1 : binding.numa_node);
+  }
+  return check_page_placement(get_page_numa_nodes(data, size), thread_nodes);
+}
+
+}  // namespace cexa::impl
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_FIRST_TOUCH_HPP
+#define CEXA_FIRST_TOUCH_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// NUMA node of every memory page of [data, data + size), -1 for the pages that
+// are not mapped yet or when it is unknown. Uses move_pages on Linux
+std::vector<int> get_page_numa_nodes(const void* data, std::size_t size);
+
+namespace impl {
+
+// Compares the node of every page with the node of the Kokkos host thread that
+// touches it, assuming the static schedule gives each thread one contiguous
+// block of pages in thread id order. Kokkos does not guarantee this partition
+// (the OpenMP backend chooses its own chunks), so the result is a heuristic.
+// thread_nodes is indexed by thread id
+std::string check_page_placement(const std::vector<int>& page_nodes,
+                                 const std::vector<int>& thread_nodes);
+
+std::string check_first_touch(const void* data, std::size_t size);
+
+}  // namespace impl
+
+// Fills a host View with value using the static RangePolicy schedule of the
+// compute kernels, so that each page is first touched, and thus placed on the
+// NUMA node of, the thread that will later work on it. The View should have
+// been allocated WithoutInitializing. Aborts if the View is not contiguous
+// (LayoutStride or padded subview), as filling its span would overwrite the
+// elements of the parent allocation that are not part of the View
+template <class ViewType>
+void first_touch_fill(const ViewType& view,
+                      const typename ViewType::non_const_value_type& value) {
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+  static_assert(
+      Kokkos::SpaceAccessibility<exec_space,
+                                 typename ViewType::memory_space>::accessible,
+      "first_touch_fill requires a View accessible from the host");
+
+  if (!view.span_is_contiguous()) {
+    Kokkos::abort("cexa::first_touch_fill requires a contiguous View");
+  }
+
+  auto* data = view.data();
+  Kokkos::parallel_for(
+      "cexa::first_touch_fill",
+      Kokkos::RangePolicy<exec_space, Kokkos::Schedule<Kokkos::Static>>(
+          0, view.span()),
+      [=](std::size_t i) { data[i] = value; });
+  Kokkos::fence("cexa::first_touch_fill");
+}
+
+// Allocates a View without initializing it, then fills it with a value
+// initialized element through first_touch_fill
+template <class ViewType, class... Extents>
+ViewType first_touch_allocate(const std::string& label, Extents... extents) {
+  ViewType view(Kokkos::view_alloc(label, Kokkos::WithoutInitializing),
+                extents...);
+  first_touch_fill(view, typename ViewType::non_const_value_type());
+  return view;
+}
+
+// One line diagnostic of the placement of the pages of a host View, starting
+// with "OK", "WARNING" or "N/A" if the page nodes can not be queried. The
+// expected node of each page assumes one contiguous block of pages per thread
+// (see impl::check_page_placement)
+template <class ViewType>
+std::string check_first_touch(const ViewType& view) {
+  return impl::check_first_touch(
+      view.data(),
+      view.span() * sizeof(typename ViewType::non_const_value_type));
+}
+
+}  // namespace cexa
+
+#endif  // CEXA_FIRST_TOUCH_HPP
@@ -0,0 +1,535 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_HugePages.hpp"
+#include "cexa_ArchInfo.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace cexa::impl {
+
+namespace {
+
+constexpr std::size_t kib = 1024;
+constexpr std::size_t mib = 1024 * kib;
+constexpr std::size_t gib = 1024 * mib;
+
+// Typical second level TLB of a recent x86 core (1536 to 2048 entries), used
+// when the TLBs are unknown
+constexpr std::size_t default_tlb_reach = 8 * mib;
+
+std::string format_size(std::size_t size) {
+  std::stringstream ss;
+  if (size >= gib && size % gib == 0) {
+    ss << size / gib << " GiB";
+  } else if (size >= mib && size % mib == 0) {
+    ss << size / mib << " MiB";
+  } else {
+    ss << size / kib << " KiB";
+  }
+  return ss.str();
+}
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+std::optional<cpuid_regs> get_cpuid(std::uint32_t leaf,
+                                    std::uint32_t subleaf = 0) {
+  int regs[4];
+  __cpuid(regs, leaf & 0x80000000);
+  if (static_cast<std::uint32_t>(regs[0]) < leaf) {
+    return std::nullopt;
+  }
+  __cpuidex(regs, leaf, subleaf);
+  return cpuid_regs{static_cast<std::uint32_t>(regs[0]),
+                    static_cast<std::uint32_t>(regs[1]),
+                    static_cast<std::uint32_t>(regs[2]),
+                    static_cast<std::uint32_t>(regs[3])};
+}
+#elif defined(__x86_64__) || defined(__i386__)
+std::optional<cpuid_regs> get_cpuid(std::uint32_t leaf,
+                                    std::uint32_t subleaf = 0) {
+  if (__get_cpuid_max(leaf & 0x80000000, nullptr) < leaf) {
+    return std::nullopt;
+  }
+  cpuid_regs regs;
+  __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+  return regs;
+}
+#endif
+
+std::size_t get_page_size() {
+#if defined(_WIN32)
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  return system_info.dwPageSize;
+#else
+  return sysconf(_SC_PAGESIZE);
+#endif
+}
+
+std::size_t get_default_huge_page_size() {
+#if defined(_WIN32)
+  return GetLargePageMinimum();
+#else
+  return read_default_huge_page_size("/proc/meminfo");
+#endif
+}
+
+// Transparent huge pages are PMD mappings, whose size can differ from the
+// default hugetlbfs page size (e.g. with default_hugepagesz=1G)
+std::size_t get_transparent_huge_page_size() {
+#if defined(__linux__)
+  return read_transparent_huge_page_size(
+      "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+#else
+  return 0;
+#endif
+}
+
+}  // namespace
+
+std::vector<tlb_info> decode_cpuid_tlb_leaf(
+    const std::vector<cpuid_regs>& subleaves) {
+  static const char* types[] = {nullptr, "Data",  nullptr,
+                                "Unified", "Load", "Store"};
+  static const std::size_t page_sizes[] = {4 * kib, 2 * mib, 4 * mib, gib};
+
+  std::vector<tlb_info> tlbs;
+  for (const cpuid_regs& regs : subleaves) {
+    // Invalid subleaves and instruction TLBs are skipped
+    const std::uint32_t type = regs.edx & 0x1f;
+    if (type >= std::size(types) || types[type] == nullptr) {
+      continue;
+    }
+
+    tlb_info tlb;
+    tlb.level = regs.edx >> 5 & 0x7;
+    tlb.type  = types[type];
+    for (std::size_t i = 0; i < std::size(page_sizes); i++) {
+      if (regs.ebx >> i & 1) {
+        tlb.page_sizes.push_back(page_sizes[i]);
+      }
+    }
+    // Ways times sets, a fully associative TLB has a single set
+    tlb.entries = (regs.ebx >> 16) * regs.ecx;
+    tlbs.push_back(tlb);
+  }
+  return tlbs;
+}
+
+std::vector<tlb_info> decode_cpuid_tlb_descriptors(const cpuid_regs& regs) {
+  struct tlb_descriptor {
+    std::uint8_t descriptor;
+    tlb_info tlb;
+  };
+  // Data and shared TLBs of the Intel SDM descriptor table
+  static const std::vector<tlb_descriptor> descriptors = {
+      {0x03, {1, "Data", {4 * kib}, 64}},
+      {0x04, {1, "Data", {4 * mib}, 8}},
+      {0x05, {1, "Data", {4 * mib}, 32}},
+      {0x56, {1, "Data", {4 * mib}, 16}},
+      {0x57, {1, "Data", {4 * kib}, 16}},
+      {0x59, {1, "Data", {4 * kib}, 16}},
+      {0x5a, {1, "Data", {2 * mib, 4 * mib}, 32}},
+      {0x5b, {1, "Data", {4 * kib, 4 * mib}, 64}},
+      {0x5c, {1, "Data", {4 * kib, 4 * mib}, 128}},
+      {0x5d, {1, "Data", {4 * kib, 4 * mib}, 256}},
+      {0x63, {1, "Data", {2 * mib, 4 * mib}, 32}},
+      {0x63, {1, "Data", {gib}, 4}},
+      {0x64, {1, "Data", {4 * kib}, 512}},
+      {0xa0, {1, "Data", {4 * kib}, 32}},
+      {0xb3, {1, "Data", {4 * kib}, 128}},
+      {0xb4, {1, "Data", {4 * kib}, 256}},
+      {0xba, {1, "Data", {4 * kib}, 64}},
+      {0xc0, {1, "Data", {4 * kib, 4 * mib}, 8}},
+      {0xc1, {2, "Unified", {4 * kib, 2 * mib}, 1024}},
+      {0xc2, {1, "Data", {4 * kib, 2 * mib}, 16}},
+      {0xc3, {2, "Unified", {4 * kib, 2 * mib}, 1536}},
+      {0xc3, {2, "Unified", {gib}, 16}},
+      {0xc4, {1, "Data", {2 * mib, 4 * mib}, 32}},
+      {0xca, {2, "Unified", {4 * kib}, 512}}};
+
+  // One descriptor per byte, except the lowest byte of eax (always 1). A
+  // register with bit 31 set holds no descriptor
+  const std::uint32_t registers[] = {regs.eax, regs.ebx, regs.ecx, regs.edx};
+  std::vector<std::uint8_t> bytes;
+  for (std::size_t r = 0; r < std::size(registers); r++) {
+    if (registers[r] >> 31 & 1) {
+      continue;
+    }
+    for (int i = (r == 0 ? 1 : 0); i < 4; i++) {
+      bytes.push_back(registers[r] >> (8 * i) & 0xff);
+    }
+  }
+
+  std::vector<tlb_info> tlbs;
+  for (std::uint8_t byte : bytes) {
+    for (const tlb_descriptor& descriptor : descriptors) {
+      if (descriptor.descriptor == byte) {
+        tlbs.push_back(descriptor.tlb);
+      }
+    }
+  }
+  return tlbs;
+}
+
+std::vector<tlb_info> decode_cpuid_amd_tlbs(const cpuid_regs& l1,
+                                            const cpuid_regs& l2) {
+  // The 4 KiB entries are in ebx, the 2 MiB and 4 MiB ones in eax
+  const tlb_info candidates[] = {
+      {1, "Data", {4 * kib}, l1.ebx >> 16 & 0xff},
+      {1, "Data", {2 * mib, 4 * mib}, l1.eax >> 16 & 0xff},
+      {2, "Data", {4 * kib}, l2.ebx >> 16 & 0xfff},
+      {2, "Data", {2 * mib, 4 * mib}, l2.eax >> 16 & 0xfff}};
+
+  std::vector<tlb_info> tlbs;
+  for (const tlb_info& tlb : candidates) {
+    if (tlb.entries > 0) {
+      tlbs.push_back(tlb);
+    }
+  }
+  return tlbs;
+}
+
+std::vector<tlb_info> read_cpuid_tlbs() {
+  std::vector<tlb_info> tlbs;
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+  // Intel since Skylake (leaf 0x18), then older Intel (leaf 0x2), then AMD
+  std::optional<cpuid_regs> leaf_0x18 = get_cpuid(0x18);
+  if (leaf_0x18.has_value()) {
+    std::vector<cpuid_regs> subleaves = {leaf_0x18.value()};
+    for (std::uint32_t i = 1; i <= leaf_0x18->eax; i++) {
+      subleaves.push_back(get_cpuid(0x18, i).value());
+    }
+    tlbs = decode_cpuid_tlb_leaf(subleaves);
+  }
+
+  std::optional<cpuid_regs> leaf_0x2 = get_cpuid(0x2);
+  if (tlbs.empty() && leaf_0x2.has_value()) {
+    tlbs = decode_cpuid_tlb_descriptors(leaf_0x2.value());
+  }
+
+  std::optional<cpuid_regs> l1 = get_cpuid(0x80000005);
+  std::optional<cpuid_regs> l2 = get_cpuid(0x80000006);
+  if (tlbs.empty() && l1.has_value() && l2.has_value()) {
+    tlbs = decode_cpuid_amd_tlbs(l1.value(), l2.value());
+  }
+#endif
+
+  std::stable_sort(
+      tlbs.begin(), tlbs.end(),
+      [](const tlb_info& a, const tlb_info& b) { return a.level < b.level; });
+  return tlbs;
+}
+
+std::vector<huge_page_pool> read_huge_page_pools(const std::string& dir) {
+  namespace fs = std::filesystem;
+
+  std::vector<huge_page_pool> pools;
+  std::error_code ec;
+  for (const fs::directory_entry& entry : fs::directory_iterator(dir, ec)) {
+    // "hugepages-2048kB"
+    std::string name = entry.path().filename().string();
+    huge_page_pool pool;
+    if (std::sscanf(name.c_str(), "hugepages-%zukB", &pool.page_size) != 1) {
+      continue;
+    }
+    pool.page_size *= kib;
+    std::ifstream(entry.path() / "nr_hugepages") >> pool.n_pages;
+    std::ifstream(entry.path() / "free_hugepages") >> pool.n_free;
+    pools.push_back(pool);
+  }
+
+  std::sort(pools.begin(), pools.end(),
+            [](const huge_page_pool& a, const huge_page_pool& b) {
+              return a.page_size < b.page_size;
+            });
+  return pools;
+}
+
+std::size_t read_default_huge_page_size(const std::string& meminfo_file) {
+  // "Hugepagesize:       2048 kB"
+  std::ifstream file(meminfo_file);
+  std::string key;
+  std::size_t value;
+  while (file >> key >> value) {
+    if (key == "Hugepagesize:") {
+      return value * kib;
+    }
+    file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+  return 0;
+}
+
+std::size_t read_transparent_huge_page_size(const std::string& file) {
+  // In bytes: "2097152"
+  std::ifstream size_file(file);
+  std::size_t size = 0;
+  return size_file >> size ? size : 0;
+}
+
+std::size_t read_anon_huge_pages(const std::string& smaps_file,
+                                 const void* address) {
+  const std::uintptr_t target = reinterpret_cast<std::uintptr_t>(address);
+
+  // A header line per mapping ("7f0000000000-7f0000400000 rw-p ..."), followed
+  // by its fields ("AnonHugePages:      2048 kB")
+  std::ifstream file(smaps_file);
+  std::string line;
+  bool in_mapping = false;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string first;
+    ss >> first;
+    if (!first.empty() && first.back() != ':') {
+      std::uintptr_t begin = 0;
+      std::uintptr_t end   = 0;
+      char dash            = 0;
+      std::stringstream range(first);
+      range >> std::hex >> begin >> dash >> end;
+      in_mapping = dash == '-' && begin <= target && target < end;
+    } else if (in_mapping && first == "AnonHugePages:") {
+      std::size_t value = 0;
+      ss >> value;
+      return value * kib;
+    }
+  }
+  return 0;
+}
+
+std::string test_map_hugetlb(std::size_t huge_page_size) {
+#if defined(__linux__)
+  if (huge_page_size == 0) {
+    return "N/A: the kernel has no huge pages";
+  }
+  void* data = mmap(nullptr, huge_page_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (data == MAP_FAILED) {
+    return "WARNING: MAP_HUGETLB failed (" + std::string(std::strerror(errno)) +
+           "), reserve huge pages through /proc/sys/vm/nr_hugepages";
+  }
+  static_cast<volatile char*>(data)[0] = 1;
+  munmap(data, huge_page_size);
+  return "OK: mapped a " + format_size(huge_page_size) + " page";
+#else
+  (void)huge_page_size;
+  return "N/A: MAP_HUGETLB is Linux only";
+#endif
+}
+
+std::string test_madv_hugepage(std::size_t huge_page_size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (huge_page_size == 0) {
+    return "N/A: the kernel has no huge pages";
+  }
+
+  // Twice the size to hold an aligned huge page
+  const std::size_t size = 2 * huge_page_size;
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    return "N/A: mmap failed (" + std::string(std::strerror(errno)) + ")";
+  }
+  char* aligned = reinterpret_cast<char*>(
+      (reinterpret_cast<std::uintptr_t>(data) + huge_page_size - 1) /
+      huge_page_size * huge_page_size);
+
+  std::string result;
+  if (madvise(aligned, huge_page_size, MADV_HUGEPAGE) != 0) {
+    result = "WARNING: madvise(MADV_HUGEPAGE) failed (" +
+             std::string(std::strerror(errno)) + ")";
+  } else {
+    std::memset(aligned, 1, huge_page_size);
+    result = read_anon_huge_pages("/proc/self/smaps", aligned) > 0
+                 ? "OK: an advised " + format_size(huge_page_size) +
+                       " range is backed by a huge page"
+                 : "WARNING: an advised range is not backed by huge pages "
+                   "(transparent huge pages disabled, or memory too "
+                   "fragmented)";
+  }
+  munmap(data, size);
+  return result;
+#else
+  (void)huge_page_size;
+  return "N/A: MADV_HUGEPAGE is Linux only";
+#endif
+}
+
+std::size_t get_tlb_reach(const page_info& info) {
+  std::size_t reach = 0;
+  for (const tlb_info& tlb : info.tlbs) {
+    if (std::find(tlb.page_sizes.begin(), tlb.page_sizes.end(),
+                  info.page_size) != tlb.page_sizes.end()) {
+      reach = std::max(reach, tlb.entries * info.page_size);
+    }
+  }
+  return reach;
+}
+
+huge_page_advice recommend_huge_pages(const page_info& info,
+                                      std::size_t size) {
+  const std::size_t tlb_reach = get_tlb_reach(info);
+  const std::size_t threshold = tlb_reach > 0 ? tlb_reach : default_tlb_reach;
+  if (size < threshold) {
+    return {huge_page_mode::none,
+            format_size(size) + " fits in the " + format_size(threshold) +
+                " TLB reach of the base pages" +
+                (tlb_reach > 0 ? "" : " (TLBs unknown, typical value)")};
+  }
+
+  if (info.madv_hugepage.rfind("OK", 0) == 0) {
+    return {huge_page_mode::madvise,
+            "above the " + format_size(threshold) +
+                " TLB reach of the base pages, and transparent huge pages "
+                "work on madvise"};
+  }
+
+  // MAP_HUGETLB allocations fail once the pool is exhausted
+  std::size_t free_size = 0;
+  for (const huge_page_pool& pool : info.huge_page_pools) {
+    if (pool.page_size == info.default_huge_page_size) {
+      free_size = pool.n_free * pool.page_size;
+    }
+  }
+  if (info.map_hugetlb.rfind("OK", 0) == 0 && free_size >= size) {
+    return {huge_page_mode::hugetlb,
+            "above the " + format_size(threshold) +
+                " TLB reach of the base pages, transparent huge pages do not "
+                "work but the huge page pool has " +
+                format_size(free_size) + " free"};
+  }
+
+  return {huge_page_mode::none,
+          "above the " + format_size(threshold) +
+              " TLB reach of the base pages, but no huge page mechanism "
+              "passed its self-test"};
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+page_info get_page_info() {
+  static const page_info info = [] {
+    page_info info;
+    info.page_size              = impl::get_page_size();
+    info.default_huge_page_size = impl::get_default_huge_page_size();
+    info.transparent_huge_page_size =
+        impl::get_transparent_huge_page_size();
+    info.transparent_hugepage = get_kernel_tunables().transparent_hugepage;
+    info.tlbs                 = impl::read_cpuid_tlbs();
+    info.huge_page_pools =
+        impl::read_huge_page_pools("/sys/kernel/mm/hugepages");
+
+    info.map_hugetlb   = impl::test_map_hugetlb(info.default_huge_page_size);
+    info.madv_hugepage =
+        impl::test_madv_hugepage(info.transparent_huge_page_size);
+    return info;
+  }();
+  return info;
+}
+
+huge_page_advice recommend_huge_pages(std::size_t size) {
+  return impl::recommend_huge_pages(get_page_info(), size);
+}
+
+bool advise_huge_pages(void* data, std::size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  static const std::size_t huge_page_size =
+      impl::get_transparent_huge_page_size();
+  if (huge_page_size == 0) {
+    return false;
+  }
+
+  // madvise needs page aligned bounds, only whole huge pages can be promoted
+  const std::uintptr_t begin =
+      (reinterpret_cast<std::uintptr_t>(data) + huge_page_size - 1) /
+      huge_page_size * huge_page_size;
+  const std::uintptr_t end =
+      (reinterpret_cast<std::uintptr_t>(data) + size) / huge_page_size *
+      huge_page_size;
+  return begin < end && madvise(reinterpret_cast<void*>(begin), end - begin,
+                                MADV_HUGEPAGE) == 0;
+#else
+  (void)data;
+  (void)size;
+  return false;
+#endif
+}
+
+void print_page_info(std::ostream& ostream) {
+  page_info info = get_page_info();
+
+  ostream << "PAGES:\n"
+          << "- Page size: " << impl::format_size(info.page_size) << '\n'
+          << "- Default huge page size: "
+          << (info.default_huge_page_size > 0
+                  ? impl::format_size(info.default_huge_page_size)
+                  : "N/A")
+          << '\n'
+          << "- Transparent huge page size: "
+          << (info.transparent_huge_page_size > 0
+                  ? impl::format_size(info.transparent_huge_page_size)
+                  : "N/A")
+          << '\n';
+
+  // 2 MiB 16/16 free, 1 GiB 0/0 free
+  ostream << "- Huge page pools:";
+  for (const huge_page_pool& pool : info.huge_page_pools) {
+    ostream << ' ' << impl::format_size(pool.page_size) << ' ' << pool.n_free
+            << '/' << pool.n_pages << " free"
+            << (&pool == &info.huge_page_pools.back() ? "" : ",");
+  }
+  ostream << (info.huge_page_pools.empty() ? " N/A\n" : "\n")
+          << "- Transparent huge pages: " << info.transparent_hugepage << '\n';
+
+  // L1 Data 64 entries (4 KiB), L2 Unified 2048 entries (4 KiB, 2 MiB)
+  ostream << "- TLBs:";
+  for (const tlb_info& tlb : info.tlbs) {
+    ostream << " L" << tlb.level << ' ' << tlb.type << ' ' << tlb.entries
+            << " entries (";
+    for (std::size_t i = 0; i < tlb.page_sizes.size(); i++) {
+      ostream << (i == 0 ? "" : ", ") << impl::format_size(tlb.page_sizes[i]);
+    }
+    ostream << ')' << (&tlb == &info.tlbs.back() ? "" : ",");
+  }
+  const std::size_t tlb_reach = impl::get_tlb_reach(info);
+  ostream << (info.tlbs.empty() ? " N/A\n" : "\n") << "- TLB reach: "
+          << (tlb_reach > 0 ? impl::format_size(tlb_reach) : "N/A") << '\n'
+          << "- MAP_HUGETLB: " << info.map_hugetlb << '\n'
+          << "- MADV_HUGEPAGE: " << info.madv_hugepage << '\n';
+
+  huge_page_advice advice = recommend_huge_pages(1 * impl::gib);
+  ostream << "- Advice for 1 GiB arrays: "
+          << (advice.mode == huge_page_mode::madvise   ? "madvise"
+              : advice.mode == huge_page_mode::hugetlb ? "MAP_HUGETLB"
+                                                       : "none")
+          << " (" << advice.reason << ')' << std::endl;
+}
+
+}  // namespace cexa
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_HUGE_PAGES_HPP
+#define CEXA_HUGE_PAGES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// A data translation lookaside buffer
+struct tlb_info {
+  // 1 for the dTLB, 2 for the second level (shared) TLB
+  std::size_t level = 0;
+  // "Data", "Load", "Store" or "Unified"
+  std::string type;
+  // Page sizes it caches, in bytes
+  std::vector<std::size_t> page_sizes;
+  std::size_t entries = 0;
+};
+
+// A pool of pages for MAP_HUGETLB (/sys/kernel/mm/hugepages)
+struct huge_page_pool {
+  // In bytes
+  std::size_t page_size = 0;
+  std::size_t n_pages   = 0;
+  std::size_t n_free    = 0;
+};
+
+struct page_info {
+  // In bytes
+  std::size_t page_size = 0;
+  // Size of the MAP_HUGETLB pages (Hugepagesize), 0 if there are no huge pages
+  std::size_t default_huge_page_size = 0;
+  // Size of the transparent huge pages (hpage_pmd_size), used by madvise. 0
+  // if the kernel does not support them
+  std::size_t transparent_huge_page_size = 0;
+  std::vector<huge_page_pool> huge_page_pools;
+  // "always", "madvise", "never" or "N/A"
+  std::string transparent_hugepage;
+  // Sorted by level, empty if unknown (CPUID leaves 0x18, 0x2 or
+  // 0x80000005/6 on x86 only)
+  std::vector<tlb_info> tlbs;
+  // Results of the self-tests, starting with "OK", "WARNING" or "N/A": an
+  // mmap with MAP_HUGETLB, and an madvise(MADV_HUGEPAGE) of an anonymous
+  // mapping followed by a check of its AnonHugePages in /proc/self/smaps
+  std::string map_hugetlb;
+  std::string madv_hugepage;
+};
+
+// Measured on the first call, which maps and touches a few MiB
+page_info get_page_info();
+
+enum class huge_page_mode {
+  // Base pages are enough, or no huge pages are available
+  none,
+  // madvise(MADV_HUGEPAGE) on the array, see advise_huge_pages
+  madvise,
+  // An allocation with MAP_HUGETLB from the huge page pool
+  hugetlb,
+};
+
+struct huge_page_advice {
+  huge_page_mode mode = huge_page_mode::none;
+  std::string reason;
+};
+
+namespace impl {
+
+struct cpuid_regs {
+  std::uint32_t eax;
+  std::uint32_t ebx;
+  std::uint32_t ecx;
+  std::uint32_t edx;
+};
+
+// Deterministic address translation parameters (CPUID leaf 0x18), one
+// element per subleaf
+std::vector<tlb_info> decode_cpuid_tlb_leaf(
+    const std::vector<cpuid_regs>& subleaves);
+// TLB descriptors of the legacy CPUID leaf 0x2
+std::vector<tlb_info> decode_cpuid_tlb_descriptors(const cpuid_regs& regs);
+// AMD L1 and L2 TLB identifiers (CPUID leaves 0x80000005 and 0x80000006)
+std::vector<tlb_info> decode_cpuid_amd_tlbs(const cpuid_regs& l1,
+                                            const cpuid_regs& l2);
+// Data TLBs of the CPU running the calling thread
+std::vector<tlb_info> read_cpuid_tlbs();
+
+// Pools of a Linux hugepages directory (/sys/kernel/mm/hugepages)
+std::vector<huge_page_pool> read_huge_page_pools(const std::string& dir);
+// Hugepagesize of a meminfo file, 0 if absent
+std::size_t read_default_huge_page_size(const std::string& meminfo_file);
+// Size in bytes of a transparent_hugepage/hpage_pmd_size file, 0 if absent
+std::size_t read_transparent_huge_page_size(const std::string& file);
+// AnonHugePages of the mapping of an smaps file containing address
+std::size_t read_anon_huge_pages(const std::string& smaps_file,
+                                 const void* address);
+
+std::string test_map_hugetlb(std::size_t huge_page_size);
+std::string test_madv_hugepage(std::size_t huge_page_size);
+
+// Memory covered by the largest data TLB with base pages, 0 if unknown
+std::size_t get_tlb_reach(const page_info& info);
+
+huge_page_advice recommend_huge_pages(const page_info& info, std::size_t size);
+
+}  // namespace impl
+
+// Whether an array of size bytes should use huge pages: only above the reach
+// of the TLB with base pages, where strided sweeps start missing in the TLB,
+// and only through a mechanism that passed its self-test
+huge_page_advice recommend_huge_pages(std::size_t size);
+
+// madvise(MADV_HUGEPAGE) on the huge page aligned part of [data, data + size),
+// to be called before the first touch. Returns false if nothing was advised
+bool advise_huge_pages(void* data, std::size_t size);
+
+// For the allocation of a contiguous host View, e.g. one allocated
+// WithoutInitializing and filled with first_touch_fill afterwards
+template <class ViewType>
+bool advise_huge_pages(const ViewType& view) {
+  return advise_huge_pages(view.data(),
+                           view.span() * sizeof(typename ViewType::value_type));
+}
+
+void print_page_info(std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_HUGE_PAGES_HPP
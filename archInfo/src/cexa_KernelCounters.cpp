@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_KernelCounters.hpp"
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cexa {
+
+double kernel_counters::ipc() const {
+  return cycles > 0 && instructions >= 0
+             ? static_cast<double>(instructions) / cycles
+             : 0.;
+}
+
+double kernel_counters::llc_mpki() const {
+  return instructions > 0 && llc_misses >= 0
+             ? 1000. * llc_misses / instructions
+             : 0.;
+}
+
+double kernel_counters::branch_mpki() const {
+  return instructions > 0 && branch_misses >= 0
+             ? 1000. * branch_misses / instructions
+             : 0.;
+}
+
+double kernel_counters::stalled_ratio() const {
+  return cycles > 0 && stalled_cycles >= 0
+             ? static_cast<double>(stalled_cycles) / cycles
+             : 0.;
+}
+
+}  // namespace cexa
+
+namespace cexa::impl {
+
+constexpr std::size_t n_counter_events = 5;
+using counter_values = std::array<std::int64_t, n_counter_events>;
+
+struct counter_state {
+  std::mutex mutex;
+  bool started = false;
+  std::string status = "not started";
+
+  // One group per host thread, fds[0] is the group leader. slots[i] is the
+  // event (index in counter_values) counted by fds[i]
+  struct group {
+    std::vector<int> fds;
+    std::vector<std::size_t> slots;
+  };
+  std::vector<group> groups;
+
+  std::map<std::uint64_t, std::pair<std::string, counter_values>> running;
+  std::map<std::string, kernel_counters> results;
+};
+
+counter_state& get_counter_state() {
+  static counter_state state;
+  return state;
+}
+
+#if defined(__linux__)
+
+// Same order as counter_values
+constexpr std::array<std::uint64_t, n_counter_events> counter_events = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_STALLED_CYCLES_BACKEND};
+
+int open_counter(std::uint64_t event, pid_t tid, int group_fd) {
+  perf_event_attr attr{};
+  attr.size   = sizeof(attr);
+  attr.type   = PERF_TYPE_HARDWARE;
+  attr.config = event;
+  // Counting user space only is allowed up to perf_event_paranoid=2
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return static_cast<int>(
+      syscall(SYS_perf_event_open, &attr, tid, -1, group_fd, 0));
+}
+
+// Thread ids of the Kokkos host threads, sampled with enough work items for
+// every thread of the pool to run at least one
+std::vector<pid_t> get_host_thread_ids() {
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+
+  const std::size_t n_threads = exec_space().concurrency();
+  const std::size_t n_samples = 16 * n_threads;
+  std::vector<pid_t> tids(n_samples);
+
+  pid_t* tids_ptr = tids.data();
+  Kokkos::parallel_for(
+      "cexa::get_host_thread_ids",
+      Kokkos::RangePolicy<exec_space, Kokkos::Schedule<Kokkos::Static>>(
+          0, n_samples),
+      [=](std::size_t i) {
+        tids_ptr[i] = static_cast<pid_t>(syscall(SYS_gettid));
+      });
+  Kokkos::fence("cexa::get_host_thread_ids");
+
+  std::set<pid_t> unique_tids(tids.begin(), tids.end());
+  return std::vector<pid_t>(unique_tids.begin(), unique_tids.end());
+}
+
+// Sum of the counters of every thread, scaled when the kernel multiplexed them
+counter_values read_counters(const counter_state& state) {
+  counter_values values;
+  values.fill(-1);
+
+  for (const counter_state::group& group : state.groups) {
+    // nr, time_enabled, time_running, then one value per event
+    std::array<std::uint64_t, 3 + n_counter_events> buffer{};
+    if (read(group.fds[0], buffer.data(), sizeof(buffer)) <= 0) {
+      continue;
+    }
+
+    const double scale =
+        buffer[2] > 0 ? static_cast<double>(buffer[1]) / buffer[2] : 1.;
+    for (std::size_t i = 0; i < buffer[0] && i < group.slots.size(); i++) {
+      std::int64_t& value = values[group.slots[i]];
+      value = std::max<std::int64_t>(value, 0) +
+              static_cast<std::int64_t>(buffer[3 + i] * scale);
+    }
+  }
+  return values;
+}
+
+void begin_kernel(const char* label, std::uint64_t kernel_id) {
+  counter_state& state = get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  state.running[kernel_id] = {label, read_counters(state)};
+}
+
+void end_kernel(std::uint64_t kernel_id) {
+  counter_state& state = get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  counter_values end = read_counters(state);
+  auto begin         = state.running.find(kernel_id);
+  if (begin == state.running.end()) {
+    return;
+  }
+
+  const std::string& label = begin->second.first;
+  kernel_counters& result  = state.results[label];
+  result.label             = label;
+  result.n_calls++;
+
+  std::int64_t* fields[n_counter_events] = {
+      &result.cycles, &result.instructions, &result.llc_misses,
+      &result.branch_misses, &result.stalled_cycles};
+  for (std::size_t i = 0; i < n_counter_events; i++) {
+    if (end[i] >= 0 && begin->second.second[i] >= 0) {
+      *fields[i] = std::max<std::int64_t>(*fields[i], 0) + end[i] -
+                   begin->second.second[i];
+    }
+  }
+
+  state.running.erase(begin);
+}
+
+void close_counters(counter_state& state) {
+  for (const counter_state::group& group : state.groups) {
+    for (int fd : group.fds) {
+      close(fd);
+    }
+  }
+  state.groups.clear();
+}
+
+#endif
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+#if defined(__linux__)
+
+bool start_kernel_counters() {
+  impl::counter_state& state = impl::get_counter_state();
+  std::vector<pid_t> tids    = impl::get_host_thread_ids();
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.started) {
+    return true;
+  }
+
+  int error = 0;
+  for (pid_t tid : tids) {
+    impl::counter_state::group group;
+    for (std::size_t i = 0; i < impl::n_counter_events; i++) {
+      int fd = impl::open_counter(impl::counter_events[i], tid,
+                                  group.fds.empty() ? -1 : group.fds[0]);
+      // Unsupported events are skipped, but there is no group without its
+      // leader
+      if (fd < 0) {
+        error = errno;
+        if (group.fds.empty()) {
+          break;
+        }
+        continue;
+      }
+      group.fds.push_back(fd);
+      group.slots.push_back(i);
+    }
+
+    if (!group.fds.empty()) {
+      state.groups.push_back(group);
+    }
+  }
+
+  if (state.groups.empty()) {
+    std::string paranoid = get_kernel_tunables().perf_event_paranoid;
+    state.status         = "unavailable: perf_event_open failed (" +
+                   std::string(std::strerror(error)) +
+                   "), kernel.perf_event_paranoid=" + paranoid;
+    return false;
+  }
+
+  impl::add_kernel_hooks(impl::begin_kernel, impl::end_kernel);
+
+  state.started = true;
+  state.status  = "counting on " + std::to_string(state.groups.size()) +
+                 " host thread(s)";
+  return true;
+}
+
+void stop_kernel_counters() {
+  impl::counter_state& state = impl::get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (!state.started) {
+    return;
+  }
+
+  impl::remove_kernel_hooks(impl::begin_kernel, impl::end_kernel);
+
+  impl::close_counters(state);
+  state.running.clear();
+  state.started = false;
+  state.status  = "stopped";
+}
+
+#else
+
+bool start_kernel_counters() {
+  impl::get_counter_state().status =
+      "unavailable: perf_event_open is specific to Linux";
+  return false;
+}
+
+void stop_kernel_counters() {}
+
+#endif
+
+std::vector<kernel_counters> get_kernel_counters() {
+  impl::counter_state& state = impl::get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::vector<kernel_counters> results;
+  for (const auto& [label, result] : state.results) {
+    results.push_back(result);
+  }
+  return results;
+}
+
+void reset_kernel_counters() {
+  impl::counter_state& state = impl::get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.results.clear();
+}
+
+std::string get_kernel_counters_status() {
+  impl::counter_state& state = impl::get_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.status;
+}
+
+void print_kernel_counters(std::ostream& ostream) {
+  ostream << "KERNEL COUNTERS (" << get_kernel_counters_status() << "):\n";
+  for (const kernel_counters& result : get_kernel_counters()) {
+    ostream << "- " << result.label << ": " << result.n_calls << " call(s)"
+            << std::fixed << std::setprecision(2) << ", IPC " << result.ipc()
+            << ", LLC MPKI " << result.llc_mpki() << ", branch MPKI "
+            << result.branch_mpki() << ", stalled "
+            << 100. * result.stalled_ratio() << "%" << std::defaultfloat
+            << '\n';
+  }
+  ostream << std::flush;
+}
+
+}  // namespace cexa
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_KERNEL_COUNTERS_HPP
+#define CEXA_KERNEL_COUNTERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Hardware counters accumulated over every call of a kernel, summed over the
+// Kokkos host threads. A counter is -1 if it is not supported by the CPU
+struct kernel_counters {
+  std::string label;
+  std::size_t n_calls         = 0;
+  std::int64_t cycles         = -1;
+  std::int64_t instructions   = -1;
+  std::int64_t llc_misses     = -1;
+  std::int64_t branch_misses  = -1;
+  std::int64_t stalled_cycles = -1;
+
+  // Instructions per cycle
+  double ipc() const;
+  // Misses per thousand instructions
+  double llc_mpki() const;
+  double branch_mpki() const;
+  // Fraction of the cycles stalled in the backend
+  double stalled_ratio() const;
+};
+
+// Opens a perf_event_open group (cycles, instructions, LLC misses, branch
+// misses and backend stalled cycles) for every Kokkos host thread and registers
+// Kokkos profiling callbacks accumulating them around parallel_for,
+// parallel_reduce and parallel_scan. The callbacks already registered by a
+// Kokkos tool keep being called. Returns false, without registering anything,
+// if no counter could be opened (unsupported OS, no PMU, or access forbidden
+// by perf_event_paranoid), see get_kernel_counters_status(). Must be called
+// after Kokkos::initialize.
+bool start_kernel_counters();
+// Unregisters the callbacks, restoring the ones of the Kokkos tools, and closes
+// the counters, the accumulated values are kept
+void stop_kernel_counters();
+
+std::vector<kernel_counters> get_kernel_counters();
+void reset_kernel_counters();
+// Why the counters are, or are not, available
+std::string get_kernel_counters_status();
+
+void print_kernel_counters(std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_KERNEL_COUNTERS_HPP
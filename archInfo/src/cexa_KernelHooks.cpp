@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cexa::impl {
+
+namespace {
+
+using begin_callback = void (*)(const char*, const std::uint32_t,
+                                std::uint64_t*);
+using end_callback   = void (*)(const std::uint64_t);
+
+// Indices of the callbacks of parallel_for, parallel_reduce and parallel_scan
+constexpr std::size_t n_kernel_kinds = 3;
+
+struct hook_state {
+  std::mutex mutex;
+  std::vector<std::pair<kernel_begin_hook, kernel_end_hook>> hooks;
+
+  // Callbacks registered before the first hook
+  std::array<begin_callback, n_kernel_kinds> previous_begin{};
+  std::array<end_callback, n_kernel_kinds> previous_end{};
+
+  std::uint64_t next_kernel_id = 0;
+  // Kernel id given by the previous callbacks to each running kernel
+  std::map<std::uint64_t, std::uint64_t> previous_ids;
+};
+
+hook_state& get_hook_state() {
+  static hook_state state;
+  return state;
+}
+
+// The hooks are called without holding the mutex, they take their own
+template <std::size_t kind>
+void begin_hooked_kernel(const char* label, const std::uint32_t device_id,
+                         std::uint64_t* kernel_id) {
+  hook_state& state = get_hook_state();
+  std::unique_lock<std::mutex> lock(state.mutex);
+  const std::uint64_t id  = state.next_kernel_id++;
+  begin_callback previous = state.previous_begin[kind];
+  auto hooks              = state.hooks;
+  lock.unlock();
+
+  *kernel_id = id;
+  if (previous != nullptr) {
+    std::uint64_t previous_id = 0;
+    previous(label, device_id, &previous_id);
+    lock.lock();
+    state.previous_ids[id] = previous_id;
+    lock.unlock();
+  }
+  for (const auto& hook : hooks) {
+    hook.first(label, id);
+  }
+}
+
+template <std::size_t kind>
+void end_hooked_kernel(const std::uint64_t kernel_id) {
+  hook_state& state = get_hook_state();
+  std::unique_lock<std::mutex> lock(state.mutex);
+  end_callback previous = state.previous_end[kind];
+  auto hooks            = state.hooks;
+  std::optional<std::uint64_t> previous_id;
+  auto found = state.previous_ids.find(kernel_id);
+  if (found != state.previous_ids.end()) {
+    previous_id = found->second;
+    state.previous_ids.erase(found);
+  }
+  lock.unlock();
+
+  // In the reverse order of the begin hooks, so that they nest
+  for (auto hook = hooks.rbegin(); hook != hooks.rend(); ++hook) {
+    hook->second(kernel_id);
+  }
+  if (previous != nullptr && previous_id.has_value()) {
+    previous(previous_id.value());
+  }
+}
+
+void set_kernel_callbacks(
+    const std::array<begin_callback, n_kernel_kinds>& begin,
+    const std::array<end_callback, n_kernel_kinds>& end) {
+  namespace KTE = Kokkos::Tools::Experimental;
+  KTE::set_begin_parallel_for_callback(begin[0]);
+  KTE::set_end_parallel_for_callback(end[0]);
+  KTE::set_begin_parallel_reduce_callback(begin[1]);
+  KTE::set_end_parallel_reduce_callback(end[1]);
+  KTE::set_begin_parallel_scan_callback(begin[2]);
+  KTE::set_end_parallel_scan_callback(end[2]);
+}
+
+}  // namespace
+
+void add_kernel_hooks(kernel_begin_hook begin, kernel_end_hook end) {
+  hook_state& state = get_hook_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  if (state.hooks.empty()) {
+    Kokkos::Tools::Experimental::EventSet callbacks =
+        Kokkos::Tools::Experimental::get_callbacks();
+    state.previous_begin = {callbacks.begin_parallel_for,
+                            callbacks.begin_parallel_reduce,
+                            callbacks.begin_parallel_scan};
+    state.previous_end   = {callbacks.end_parallel_for,
+                            callbacks.end_parallel_reduce,
+                            callbacks.end_parallel_scan};
+    set_kernel_callbacks(
+        {begin_hooked_kernel<0>, begin_hooked_kernel<1>,
+         begin_hooked_kernel<2>},
+        {end_hooked_kernel<0>, end_hooked_kernel<1>, end_hooked_kernel<2>});
+  }
+  state.hooks.emplace_back(begin, end);
+}
+
+void remove_kernel_hooks(kernel_begin_hook begin, kernel_end_hook end) {
+  hook_state& state = get_hook_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  auto hook = std::find(state.hooks.begin(), state.hooks.end(),
+                        std::make_pair(begin, end));
+  if (hook == state.hooks.end()) {
+    return;
+  }
+  state.hooks.erase(hook);
+
+  if (state.hooks.empty()) {
+    set_kernel_callbacks(state.previous_begin, state.previous_end);
+    state.previous_ids.clear();
+  }
+}
+
+}  // namespace cexa::impl
@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cexa::impl {
+
+std::vector<std::string> get_kokkos_backends() {
+  std::vector<std::string> backends;
+#if defined(KOKKOS_ENABLE_SERIAL)
+  backends.push_back("Serial");
+#endif
+#if defined(KOKKOS_ENABLE_OPENMP)
+  backends.push_back("OpenMP");
+#endif
+#if defined(KOKKOS_ENABLE_THREADS)
+  backends.push_back("Threads");
+#endif
+#if defined(KOKKOS_ENABLE_HPX)
+  backends.push_back("HPX");
+#endif
+#if defined(KOKKOS_ENABLE_CUDA)
+  backends.push_back("CUDA");
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+  backends.push_back("HIP");
+#endif
+#if defined(KOKKOS_ENABLE_SYCL)
+  backends.push_back("SYCL");
+#endif
+#if defined(KOKKOS_ENABLE_OPENACC)
+  backends.push_back("OpenACC");
+#endif
+#if defined(KOKKOS_ENABLE_OPENMPTARGET)
+  backends.push_back("OpenMPTarget");
+#endif
+  return backends;
+}
+
+// Host architectures, and the generic ones Kokkos derives from them (AVX2,
+// AVX512XEON, ARM_NEON, ...)
+std::vector<std::string> get_kokkos_archs() {
+  std::vector<std::string> archs;
+#if defined(KOKKOS_ARCH_NATIVE)
+  archs.push_back("NATIVE");
+#endif
+#if defined(KOKKOS_ARCH_AVX)
+  archs.push_back("AVX");
+#endif
+#if defined(KOKKOS_ARCH_AVX2)
+  archs.push_back("AVX2");
+#endif
+#if defined(KOKKOS_ARCH_AVX512XEON)
+  archs.push_back("AVX512XEON");
+#endif
+#if defined(KOKKOS_ARCH_AVX512MIC)
+  archs.push_back("AVX512MIC");
+#endif
+#if defined(KOKKOS_ARCH_SNB)
+  archs.push_back("SNB");
+#endif
+#if defined(KOKKOS_ARCH_HSW)
+  archs.push_back("HSW");
+#endif
+#if defined(KOKKOS_ARCH_BDW)
+  archs.push_back("BDW");
+#endif
+#if defined(KOKKOS_ARCH_SKL)
+  archs.push_back("SKL");
+#endif
+#if defined(KOKKOS_ARCH_SKX)
+  archs.push_back("SKX");
+#endif
+#if defined(KOKKOS_ARCH_ICL)
+  archs.push_back("ICL");
+#endif
+#if defined(KOKKOS_ARCH_ICX)
+  archs.push_back("ICX");
+#endif
+#if defined(KOKKOS_ARCH_SPR)
+  archs.push_back("SPR");
+#endif
+#if defined(KOKKOS_ARCH_KNL)
+  archs.push_back("KNL");
+#endif
+#if defined(KOKKOS_ARCH_AMD_ZEN)
+  archs.push_back("AMD_ZEN");
+#endif
+#if defined(KOKKOS_ARCH_AMD_ZEN2)
+  archs.push_back("AMD_ZEN2");
+#endif
+#if defined(KOKKOS_ARCH_AMD_ZEN3)
+  archs.push_back("AMD_ZEN3");
+#endif
+#if defined(KOKKOS_ARCH_AMD_ZEN4)
+  archs.push_back("AMD_ZEN4");
+#endif
+#if defined(KOKKOS_ARCH_AMD_ZEN5)
+  archs.push_back("AMD_ZEN5");
+#endif
+#if defined(KOKKOS_ARCH_ARM_NEON)
+  archs.push_back("ARM_NEON");
+#endif
+#if defined(KOKKOS_ARCH_ARM_SVE)
+  archs.push_back("ARM_SVE");
+#endif
+#if defined(KOKKOS_ARCH_ARMV80)
+  archs.push_back("ARMV80");
+#endif
+#if defined(KOKKOS_ARCH_ARMV81)
+  archs.push_back("ARMV81");
+#endif
+#if defined(KOKKOS_ARCH_ARMV8_THUNDERX2)
+  archs.push_back("ARMV8_THUNDERX2");
+#endif
+#if defined(KOKKOS_ARCH_A64FX)
+  archs.push_back("A64FX");
+#endif
+#if defined(KOKKOS_ARCH_ARMV9_GRACE)
+  archs.push_back("ARMV9_GRACE");
+#endif
+#if defined(KOKKOS_ARCH_POWER8)
+  archs.push_back("POWER8");
+#endif
+#if defined(KOKKOS_ARCH_POWER9)
+  archs.push_back("POWER9");
+#endif
+#if defined(KOKKOS_ARCH_RISCV_SG2042)
+  archs.push_back("RISCV_SG2042");
+#endif
+  return archs;
+}
+
+std::string get_simd_abi() {
+  namespace KE    = Kokkos::Experimental;
+  using abi_type  = typename KE::simd<double>::abi_type;
+  const auto size = std::to_string(KE::simd<double>::size());
+
+  if (std::is_same_v<abi_type, KE::simd_abi::scalar>) {
+    return "scalar";
+  }
+#if defined(KOKKOS_ARCH_AVX512XEON)
+  if (std::is_same_v<abi_type, KE::simd_abi::avx512_fixed_size<8>>) {
+    return "avx512_fixed_size<" + size + ">";
+  }
+#endif
+#if defined(KOKKOS_ARCH_AVX2)
+  if (std::is_same_v<abi_type, KE::simd_abi::avx2_fixed_size<4>>) {
+    return "avx2_fixed_size<" + size + ">";
+  }
+#endif
+#if defined(KOKKOS_ARCH_ARM_NEON)
+  if (std::is_same_v<abi_type, KE::simd_abi::neon_fixed_size<2>>) {
+    return "neon_fixed_size<" + size + ">";
+  }
+#endif
+  return "unknown (" + size + " lanes)";
+}
+
+// Instruction sets required by each host architecture, the architectures
+// missing here do not change the SIMD code generated by Kokkos
+struct arch_features {
+  const char* arch;
+  const char* feature;
+};
+
+constexpr arch_features required_features[] = {
+    {"AVX512XEON", "avx512f"}, {"AVX512MIC", "avx512f"}, {"SKX", "avx512f"},
+    {"ICL", "avx512f"},        {"ICX", "avx512f"},       {"SPR", "avx512f"},
+    {"AMD_ZEN4", "avx512f"},   {"AMD_ZEN5", "avx512f"},  {"AVX2", "avx2"},
+    {"HSW", "avx2"},           {"BDW", "avx2"},          {"SKL", "avx2"},
+    {"AMD_ZEN", "avx2"},       {"AMD_ZEN2", "avx2"},     {"AMD_ZEN3", "avx2"},
+    {"AVX", "avx"},            {"SNB", "avx"},           {"A64FX", "sve"},
+    {"ARM_SVE", "sve"},        {"ARMV9_GRACE", "sve2"},  {"ARM_NEON", "asimd"},
+};
+
+std::string check_kokkos_arch(const std::vector<std::string>& archs,
+                              const std::vector<std::string>& cpu_features) {
+  auto has = [](const std::vector<std::string>& list, const std::string& str) {
+    return std::find(list.begin(), list.end(), str) != list.end();
+  };
+
+  if (cpu_features.empty()) {
+    return "OK: the CPU features are unknown, nothing checked";
+  }
+
+  // Features used by the code Kokkos was compiled for
+  std::vector<std::string> issues, compiled_features;
+  for (const arch_features& entry : required_features) {
+    if (!has(archs, entry.arch) || has(compiled_features, entry.feature)) {
+      continue;
+    }
+    compiled_features.push_back(entry.feature);
+    if (!has(cpu_features, entry.feature)) {
+      issues.push_back("compiled for " + std::string(entry.arch) +
+                       " but the CPU lacks " + entry.feature);
+    }
+  }
+
+  // Widest vector extension of the CPU left unused
+  for (const char* feature : {"avx512f", "avx2", "sve"}) {
+    if (has(cpu_features, feature)) {
+      if (!has(compiled_features, feature) && !has(archs, "NATIVE")) {
+        issues.push_back("the CPU supports " + std::string(feature) +
+                         " but Kokkos was not compiled for it");
+      }
+      break;
+    }
+  }
+
+  std::stringstream ss;
+  ss << (issues.empty() ? "OK: " : "WARNING: ");
+  for (const std::string& issue : issues) {
+    ss << issue << ", ";
+  }
+  ss << "compiled for";
+  for (const std::string& arch : archs) {
+    ss << ' ' << arch;
+  }
+  if (archs.empty()) {
+    ss << " no host architecture";
+  }
+  return ss.str();
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+kokkos_config get_kokkos_config() {
+  kokkos_config config;
+  config.version = std::to_string(KOKKOS_VERSION_MAJOR) + "." +
+                   std::to_string(KOKKOS_VERSION_MINOR) + "." +
+                   std::to_string(KOKKOS_VERSION_PATCH);
+  config.backends   = impl::get_kokkos_backends();
+  config.archs      = impl::get_kokkos_archs();
+  config.simd_abi   = impl::get_simd_abi();
+  config.simd_width = Kokkos::Experimental::simd<double>::size();
+  config.concurrency = Kokkos::DefaultExecutionSpace().concurrency();
+  config.host_concurrency =
+      Kokkos::DefaultHostExecutionSpace().concurrency();
+
+  std::stringstream configuration;
+  Kokkos::print_configuration(configuration);
+  config.configuration = configuration.str();
+  return config;
+}
+
+std::string check_kokkos_arch() {
+  return impl::check_kokkos_arch(impl::get_kokkos_archs(), get_cpu_features());
+}
+
+void print_kokkos_info(std::ostream& ostream) {
+  kokkos_config config = get_kokkos_config();
+
+  auto print_list = [&](const std::vector<std::string>& list) {
+    for (const std::string& item : list) {
+      ostream << ' ' << item;
+    }
+    ostream << (list.empty() ? " none\n" : "\n");
+  };
+
+  ostream << "KOKKOS:\n"
+          << "- Version: " << config.version << '\n'
+          << "- Backends:";
+  print_list(config.backends);
+  ostream << "- Architectures:";
+  print_list(config.archs);
+  ostream << "- SIMD ABI: " << config.simd_abi << " (" << config.simd_width
+          << " double lanes)\n"
+          << "- Concurrency: " << config.concurrency << " (host "
+          << config.host_concurrency << ")\n"
+          << "- Architecture check: " << check_kokkos_arch() << '\n'
+          << "- Binding check: " << check_kokkos_thread_binding() << std::endl;
+}
+
+}  // namespace cexa
@@ -0,0 +1,369 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_Noise.hpp"
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cexa::impl {
+
+interrupt_counts read_interrupts(const std::string& file) {
+  std::ifstream interrupts_file(file);
+  std::string line;
+  interrupt_counts counts;
+  if (!std::getline(interrupts_file, line)) {
+    return counts;
+  }
+
+  // "           CPU0       CPU1       CPU4"
+  std::stringstream header(line);
+  std::string cpu_name;
+  while (header >> cpu_name) {
+    if (cpu_name.rfind("CPU", 0) == 0) {
+      counts.cpus.push_back(std::stoul(cpu_name.substr(3)));
+    }
+  }
+
+  // "  0:   44   0   IO-APIC   2-edge   timer", some lines (ERR, MIS) only
+  // have one count
+  while (std::getline(interrupts_file, line)) {
+    std::size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::stringstream label_stream(line.substr(0, colon));
+    std::string label;
+    label_stream >> label;
+
+    std::stringstream fields(line.substr(colon + 1));
+    std::vector<std::uint64_t> values;
+    std::string field, description;
+    while (fields >> field) {
+      if (description.empty() && values.size() < counts.cpus.size() &&
+          field.find_first_not_of("0123456789") == std::string::npos) {
+        values.push_back(std::stoull(field));
+      } else {
+        description += (description.empty() ? "" : " ") + field;
+      }
+    }
+    values.resize(counts.cpus.size(), 0);
+
+    std::string key = label + ":" + (description.empty() ? "" : " ");
+    counts.sources[key + description] = values;
+  }
+
+  return counts;
+}
+
+std::map<std::size_t, cpu_stat> read_cpu_stats(const std::string& file) {
+  std::ifstream stat_file(file);
+  std::map<std::size_t, cpu_stat> stats;
+  std::string line;
+
+  // "cpu3 user nice system idle iowait irq softirq steal guest guest_nice",
+  // the guest times are already counted in user and nice
+  while (std::getline(stat_file, line)) {
+    if (line.rfind("cpu", 0) != 0 || line.size() < 4 ||
+        !std::isdigit(static_cast<unsigned char>(line[3]))) {
+      continue;
+    }
+
+    std::stringstream fields(line.substr(3));
+    std::size_t cpu;
+    std::uint64_t times[8] = {};
+    fields >> cpu;
+    for (std::uint64_t& time : times) {
+      fields >> time;
+    }
+
+    cpu_stat stat;
+    stat.irq     = times[5];
+    stat.softirq = times[6];
+    stat.steal   = times[7];
+    for (std::uint64_t time : times) {
+      stat.total += time;
+    }
+    stats[cpu] = stat;
+  }
+
+  return stats;
+}
+
+void add_os_activity(std::vector<cpu_noise>& cpus,
+                     const interrupt_counts& interrupts_before,
+                     const interrupt_counts& interrupts_after,
+                     const std::map<std::size_t, cpu_stat>& stats_before,
+                     const std::map<std::size_t, cpu_stat>& stats_after) {
+  auto column_of = [](const interrupt_counts& counts, std::size_t cpu) {
+    auto it = std::find(counts.cpus.begin(), counts.cpus.end(), cpu);
+    return static_cast<std::size_t>(it - counts.cpus.begin());
+  };
+
+  for (cpu_noise& noise : cpus) {
+    if (noise.cpu < 0) {
+      continue;
+    }
+    const std::size_t cpu = noise.cpu;
+
+    // Interrupt counters only grow, sources may appear during the run
+    const std::size_t after_column  = column_of(interrupts_after, cpu);
+    const std::size_t before_column = column_of(interrupts_before, cpu);
+    std::uint64_t top_delta         = 0;
+    for (const auto& [source, after] : interrupts_after.sources) {
+      if (after_column >= after.size()) {
+        continue;
+      }
+      std::uint64_t before = 0;
+      auto it              = interrupts_before.sources.find(source);
+      if (it != interrupts_before.sources.end() &&
+          before_column < it->second.size()) {
+        before = it->second[before_column];
+      }
+
+      std::uint64_t delta =
+          after[after_column] > before ? after[after_column] - before : 0;
+      noise.interrupts += delta;
+      if (delta > top_delta) {
+        top_delta           = delta;
+        noise.top_interrupt = source;
+      }
+    }
+
+    auto before = stats_before.find(cpu);
+    auto after  = stats_after.find(cpu);
+    if (before != stats_before.end() && after != stats_after.end() &&
+        after->second.total > before->second.total) {
+      const cpu_stat& b = before->second;
+      const cpu_stat& a = after->second;
+      noise.irq_fraction =
+          static_cast<double>((a.irq - b.irq) + (a.softirq - b.softirq) +
+                              (a.steal - b.steal)) /
+          (a.total - b.total);
+    }
+  }
+}
+
+std::vector<std::size_t> find_noisy_cpus(const std::vector<cpu_noise>& cpus,
+                                         double duration) {
+  std::vector<const cpu_noise*> known;
+  for (const cpu_noise& noise : cpus) {
+    if (noise.cpu >= 0) {
+      known.push_back(&noise);
+    }
+  }
+  if (known.empty()) {
+    return {};
+  }
+
+  auto median = [&](auto value) {
+    std::vector<double> values;
+    for (const cpu_noise* noise : known) {
+      values.push_back(value(*noise));
+    }
+    std::nth_element(values.begin(), values.begin() + values.size() / 2,
+                     values.end());
+    return values[values.size() / 2];
+  };
+  auto lost = [](const cpu_noise& noise) { return noise.lost_fraction; };
+  auto max_delay = [](const cpu_noise& noise) { return noise.max_delay; };
+  auto interrupt_rate = [&](const cpu_noise& noise) {
+    return duration > 0. ? noise.interrupts / duration : 0.;
+  };
+
+  const double median_lost           = median(lost);
+  const double median_max_delay      = median(max_delay);
+  const double median_interrupt_rate = median(interrupt_rate);
+
+  std::vector<std::size_t> noisy;
+  for (const cpu_noise* noise : known) {
+    if ((lost(*noise) > 1e-3 && lost(*noise) > 3. * median_lost) ||
+        (max_delay(*noise) > 1e5 &&
+         max_delay(*noise) > 5. * median_max_delay) ||
+        (interrupt_rate(*noise) > 1e3 &&
+         interrupt_rate(*noise) > 5. * median_interrupt_rate)) {
+      noisy.push_back(noise->cpu);
+    }
+  }
+
+  std::sort(noisy.begin(), noisy.end());
+  noisy.erase(std::unique(noisy.begin(), noisy.end()), noisy.end());
+  return noisy;
+}
+
+cpu_noise run_work_quanta(double duration) {
+  using clock = std::chrono::steady_clock;
+  auto elapsed_ns = [](clock::time_point begin, clock::time_point end) {
+    return std::chrono::duration<double, std::nano>(end - begin).count();
+  };
+
+  // A chain of dependent multiply-adds taking about a microsecond
+  std::uint64_t state = 1;
+  auto work           = [&]() {
+    for (int i = 0; i < 1000; i++) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+  };
+
+  cpu_noise noise;
+  const int first_cpu = get_current_cpu();
+
+  // The uninterrupted duration is the shortest of a warm up run. Successive
+  // quanta share their time stamps so that no interruption falls between two
+  // measurements
+  noise.quantum        = 1e9;
+  clock::time_point t0 = clock::now();
+  for (int i = 0; i < 1000; i++) {
+    work();
+    clock::time_point t1 = clock::now();
+    noise.quantum        = std::min(noise.quantum, elapsed_ns(t0, t1));
+    t0                   = t1;
+  }
+
+  const clock::time_point begin = clock::now();
+  const clock::time_point end =
+      begin + std::chrono::duration_cast<clock::duration>(
+                  std::chrono::duration<double>(duration));
+  double lost = 0.;
+  t0          = begin;
+  while (t0 < end) {
+    work();
+    clock::time_point t1 = clock::now();
+    double delay         = elapsed_ns(t0, t1) - noise.quantum;
+    t0                   = t1;
+    noise.n_quanta++;
+
+    if (delay < 1e3) {
+      continue;
+    }
+    const int bin = static_cast<int>(std::log10(delay * 1e-3));
+    noise.histogram[std::min(bin, 4)]++;
+    noise.max_delay = std::max(noise.max_delay, delay);
+    lost += delay;
+  }
+  noise.lost_fraction = lost / std::max(elapsed_ns(begin, t0), 1.);
+
+  noise.cpu = get_current_cpu() == first_cpu ? first_cpu : -1;
+  // Keeps the work from being optimized away
+  if (state == 0) {
+    noise.n_quanta = 0;
+  }
+  return noise;
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+noise_report measure_noise(double duration) {
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+
+  const std::size_t n_threads = exec_space().concurrency();
+  std::vector<cpu_noise> results(n_threads);
+
+  impl::interrupt_counts interrupts_before =
+      impl::read_interrupts("/proc/interrupts");
+  std::map<std::size_t, impl::cpu_stat> stats_before =
+      impl::read_cpu_stats("/proc/stat");
+
+  // One work item per thread under a static schedule
+  cpu_noise* results_ptr = results.data();
+  Kokkos::parallel_for(
+      "cexa::measure_noise",
+      Kokkos::RangePolicy<exec_space, Kokkos::Schedule<Kokkos::Static>>(
+          0, n_threads),
+      [=](std::size_t i) {
+        results_ptr[i]        = impl::run_work_quanta(duration);
+        results_ptr[i].thread = i;
+      });
+  Kokkos::fence("cexa::measure_noise");
+
+  impl::add_os_activity(results, interrupts_before,
+                        impl::read_interrupts("/proc/interrupts"),
+                        stats_before, impl::read_cpu_stats("/proc/stat"));
+
+  noise_report report;
+  report.duration   = duration;
+  report.cpus       = results;
+  report.noisy_cpus = impl::find_noisy_cpus(results, duration);
+
+  // The SMT siblings of a noisy CPU share its core, and thus its noise
+  for (const cpu_core& core : get_cpu_cores()) {
+    for (std::size_t cpu : core.cpus) {
+      if (std::binary_search(report.noisy_cpus.begin(),
+                             report.noisy_cpus.end(), cpu)) {
+        report.avoid_cpus.insert(report.avoid_cpus.end(), core.cpus.begin(),
+                                 core.cpus.end());
+        break;
+      }
+    }
+  }
+  for (std::size_t cpu : report.noisy_cpus) {
+    report.avoid_cpus.push_back(cpu);
+  }
+  std::sort(report.avoid_cpus.begin(), report.avoid_cpus.end());
+  report.avoid_cpus.erase(
+      std::unique(report.avoid_cpus.begin(), report.avoid_cpus.end()),
+      report.avoid_cpus.end());
+
+  std::vector<std::size_t> places;
+  for (std::size_t cpu : get_cpu_placement(cpu_placement::one_per_core)) {
+    if (!std::binary_search(report.avoid_cpus.begin(),
+                            report.avoid_cpus.end(), cpu)) {
+      places.push_back(cpu);
+    }
+  }
+  report.omp_places = format_omp_places(places);
+
+  return report;
+}
+
+void print_noise_report(const noise_report& report, std::ostream& ostream) {
+  ostream << "NOISE (" << report.duration << " s per thread):\n";
+  for (const cpu_noise& noise : report.cpus) {
+    const bool noisy = noise.cpu >= 0 &&
+                       std::binary_search(report.noisy_cpus.begin(),
+                                          report.noisy_cpus.end(),
+                                          static_cast<std::size_t>(noise.cpu));
+
+    ostream << "- Thread " << noise.thread << " on CPU ";
+    if (noise.cpu >= 0) {
+      ostream << noise.cpu;
+    } else {
+      ostream << "?";
+    }
+    ostream << std::fixed << std::setprecision(3) << ": lost "
+            << 100. * noise.lost_fraction << "%, max delay "
+            << noise.max_delay * 1e-3 << " us, interruptions of 1us/10us/"
+            << "100us/1ms/10ms";
+    for (std::size_t bin = 0; bin < noise.histogram.size(); bin++) {
+      ostream << (bin == 0 ? ' ' : '/') << noise.histogram[bin];
+    }
+    ostream << ", " << noise.interrupts << " interrupts";
+    if (!noise.top_interrupt.empty()) {
+      ostream << " (mostly " << noise.top_interrupt << ")";
+    }
+    ostream << ", irq " << 100. * noise.irq_fraction << "%" << std::defaultfloat
+            << (noisy ? " <- noisy" : "") << '\n';
+  }
+
+  ostream << "- CPUs to avoid: "
+          << (report.avoid_cpus.empty()
+                  ? "none"
+                  : impl::format_cpu_list(report.avoid_cpus))
+          << '\n'
+          << "- OMP_PLACES: " << report.omp_places << std::endl;
+}
+
+}  // namespace cexa
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_NOISE_HPP
+#define CEXA_NOISE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Interruptions seen by one Kokkos host thread running a fixed work quantum
+// loop, and the activity of the OS on its CPU over the same period
+struct cpu_noise {
+  std::size_t thread = 0;
+  // Logical CPU of the thread, -1 if unknown or if the thread migrated
+  int cpu = -1;
+  std::size_t n_quanta = 0;
+  // Duration of an uninterrupted quantum, in ns
+  double quantum = 0.;
+  // Number of interruptions by duration: [1, 10) us, [10, 100) us,
+  // [100 us, 1 ms), [1, 10) ms and >= 10 ms
+  std::array<std::size_t, 5> histogram{};
+  // Longest interruption, in ns
+  double max_delay = 0.;
+  // Fraction of the time lost to interruptions
+  double lost_fraction = 0.;
+  // Interrupts received by the CPU (/proc/interrupts), and the source that
+  // sent the most of them
+  std::uint64_t interrupts = 0;
+  std::string top_interrupt;
+  // Fraction of the time spent in irq, softirq and steal (/proc/stat)
+  double irq_fraction = 0.;
+};
+
+struct noise_report {
+  // In seconds
+  double duration = 0.;
+  std::vector<cpu_noise> cpus;
+  // CPUs with clearly more noise than the others
+  std::vector<std::size_t> noisy_cpus;
+  // Every logical CPU of the cores holding a noisy CPU
+  std::vector<std::size_t> avoid_cpus;
+  // One place per core, without the cores to avoid, for OMP_PLACES
+  std::string omp_places;
+};
+
+namespace impl {
+
+// Per CPU counts of /proc/interrupts, keyed by "<irq>: <description>"
+struct interrupt_counts {
+  // Logical CPU of each column
+  std::vector<std::size_t> cpus;
+  std::map<std::string, std::vector<std::uint64_t>> sources;
+};
+
+// In clock ticks
+struct cpu_stat {
+  std::uint64_t irq     = 0;
+  std::uint64_t softirq = 0;
+  std::uint64_t steal   = 0;
+  std::uint64_t total   = 0;
+};
+
+// Empty if the file does not exist (non Linux systems)
+interrupt_counts read_interrupts(const std::string& file);
+std::map<std::size_t, cpu_stat> read_cpu_stats(const std::string& file);
+
+// Adds the interrupt and /proc/stat deltas between before and after to the
+// entries of cpus
+void add_os_activity(std::vector<cpu_noise>& cpus,
+                     const interrupt_counts& interrupts_before,
+                     const interrupt_counts& interrupts_after,
+                     const std::map<std::size_t, cpu_stat>& stats_before,
+                     const std::map<std::size_t, cpu_stat>& stats_after);
+
+// CPUs losing more than 0.1% of their time and 3 times the median, with
+// interruptions longer than 100 us and 5 times the median, or receiving more
+// than 1000 interrupts per second and 5 times the median
+std::vector<std::size_t> find_noisy_cpus(const std::vector<cpu_noise>& cpus,
+                                         double duration);
+
+// Fixed work quantum loop of one thread, for duration seconds
+cpu_noise run_work_quanta(double duration);
+
+}  // namespace impl
+
+// Runs a fixed work quantum loop on every Kokkos host thread for duration
+// seconds and reports the interruptions of each CPU, along with the cores to
+// avoid. The threads should be bound (e.g. OMP_PROC_BIND=close), the CPUs of
+// migrating threads are unknown
+noise_report measure_noise(double duration = 1.);
+
+void print_noise_report(const noise_report& report,
+                        std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_NOISE_HPP
@@ -0,0 +1,423 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_RankPlacement.hpp"
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace cexa::impl {
+
+namespace {
+
+std::optional<std::size_t> get_env_size(const char* name) {
+  const char* value = std::getenv(name);
+  if (value == nullptr || !std::isdigit(static_cast<unsigned char>(*value))) {
+    return std::nullopt;
+  }
+  return std::strtoul(value, nullptr, 10);
+}
+
+// "2(x3),1" lists the number of tasks of each node: 2, 2, 2, 1
+std::vector<std::size_t> parse_slurm_tasks_per_node(const std::string& tasks) {
+  std::vector<std::size_t> counts;
+  std::stringstream ss(tasks);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (item.empty() || !std::isdigit(static_cast<unsigned char>(item[0]))) {
+      continue;
+    }
+    std::size_t count  = std::stoul(item);
+    std::size_t repeat = 1;
+    std::size_t x      = item.find("(x");
+    if (x != std::string::npos) {
+      repeat = std::stoul(item.substr(x + 2));
+    }
+    counts.insert(counts.end(), repeat, count);
+  }
+  return counts;
+}
+
+// Placement files have one "rank <run> <rank> <pid> <concurrency> <cpus>
+// <numa nodes>" line per rank and one "done <run> <rank>" line per released
+// rank, the empty lists being written as "-". The lines of other runs, left
+// behind by a crashed job or by a launcher whose pid was reused, are ignored
+std::string format_list(const std::vector<std::size_t>& values) {
+  return values.empty() ? "-" : format_cpu_list(values);
+}
+
+}  // namespace
+
+std::optional<local_rank> get_local_rank() {
+  static const char* launchers[][2] = {
+      {"OMPI_COMM_WORLD_LOCAL_RANK", "OMPI_COMM_WORLD_LOCAL_SIZE"},
+      {"MPI_LOCALRANKID", "MPI_LOCALNRANKS"},
+      {"PALS_LOCAL_RANKID", "PALS_LOCAL_SIZE"},
+      {"PMI_LOCAL_RANK", "PMI_LOCAL_SIZE"},
+  };
+  for (const auto& [rank_name, size_name] : launchers) {
+    std::optional<std::size_t> rank = get_env_size(rank_name);
+    std::optional<std::size_t> size = get_env_size(size_name);
+    if (rank.has_value() && size.has_value() &&
+        rank.value() < size.value()) {
+      return local_rank{rank.value(), size.value()};
+    }
+  }
+
+  // Slurm only gives the number of tasks of every node of the step
+  std::optional<std::size_t> rank = get_env_size("SLURM_LOCALID");
+  std::optional<std::size_t> node = get_env_size("SLURM_NODEID");
+  const char* tasks               = std::getenv("SLURM_STEP_TASKS_PER_NODE");
+  if (rank.has_value() && node.has_value() && tasks != nullptr) {
+    std::vector<std::size_t> counts = parse_slurm_tasks_per_node(tasks);
+    if (node.value() < counts.size() &&
+        rank.value() < counts[node.value()]) {
+      return local_rank{rank.value(), counts[node.value()]};
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::string get_placement_run_id() {
+  // Job and step ids of the launchers, which differ between the steps of a job
+  static const char* variables[] = {"SLURM_JOB_ID",   "SLURM_STEP_ID",
+                                    "PMIX_NAMESPACE", "OMPI_MCA_ess_base_jobid",
+                                    "PALS_APID",      "PBS_JOBID"};
+  std::string id;
+  for (const char* variable : variables) {
+    const char* value = std::getenv(variable);
+    if (value != nullptr && value[0] != '\0') {
+      id += std::string(value) + ".";
+    }
+  }
+
+#if defined(__linux__)
+  // Start time of the launcher (field 22 of /proc/<pid>/stat, the 20th after
+  // the command name), which tells apart two launchers with the same pid
+  std::ifstream stat_file("/proc/" + std::to_string(getppid()) + "/stat");
+  std::string stat((std::istreambuf_iterator<char>(stat_file)),
+                   std::istreambuf_iterator<char>());
+  std::size_t command_end = stat.rfind(')');
+  if (command_end != std::string::npos) {
+    std::stringstream ss(stat.substr(command_end + 1));
+    std::vector<std::string> fields{std::istream_iterator<std::string>(ss),
+                                    std::istream_iterator<std::string>()};
+    if (fields.size() >= 20) {
+      id += fields[19];
+    }
+  }
+#endif
+
+  // The id is a single field of the lines of the placement file
+  for (char& c : id) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  return id.empty() ? "-" : id;
+}
+
+std::string get_default_placement_file() {
+  namespace fs = std::filesystem;
+
+  const char* file = std::getenv("CEXA_PLACEMENT_FILE");
+  if (file != nullptr && file[0] != '\0') {
+    return file;
+  }
+
+#if defined(_WIN32)
+  const std::string launcher_id = "0";
+#else
+  const std::string launcher_id = std::to_string(getppid());
+#endif
+
+  std::error_code ec;
+  fs::path dir = fs::is_directory("/dev/shm", ec) ? fs::path("/dev/shm")
+                                                  : fs::temp_directory_path(ec);
+  return (dir / ("cexa_placement_" + launcher_id)).string();
+}
+
+void publish_rank_placement(const std::string& file, const std::string& run,
+                            const rank_placement& placement) {
+  std::stringstream line;
+  line << "rank " << run << ' ' << placement.rank << ' ' << placement.pid << ' '
+       << placement.concurrency << ' ' << format_list(placement.cpus) << ' '
+       << format_list(placement.numa_nodes) << '\n';
+
+  std::ofstream(file, std::ios::app) << line.str() << std::flush;
+}
+
+std::vector<rank_placement> collect_rank_placements(const std::string& file,
+                                                    const std::string& run,
+                                                    std::size_t n_ranks,
+                                                    double timeout) {
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(timeout));
+
+  std::map<std::size_t, rank_placement> placements;
+  while (true) {
+    std::ifstream placement_file(file);
+    std::string line;
+    while (std::getline(placement_file, line)) {
+      std::stringstream fields(line);
+      std::string type, line_run, cpus, numa_nodes;
+      rank_placement placement;
+      if (fields >> type >> line_run >> placement.rank >> placement.pid >>
+              placement.concurrency >> cpus >> numa_nodes &&
+          type == "rank" && line_run == run && placement.rank < n_ranks) {
+        placement.cpus             = parse_cpu_list(cpus);
+        placement.numa_nodes       = parse_cpu_list(numa_nodes);
+        placements[placement.rank] = placement;
+      }
+    }
+
+    if (placements.size() == n_ranks ||
+        std::chrono::steady_clock::now() > deadline) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::vector<rank_placement> result;
+  for (const auto& [rank, placement] : placements) {
+    result.push_back(placement);
+  }
+  return result;
+}
+
+void release_rank_placements(const std::string& file, const std::string& run,
+                             std::size_t rank, std::size_t n_ranks) {
+  std::ofstream(file, std::ios::app)
+      << "done " + run + " " + std::to_string(rank) + "\n" << std::flush;
+
+  // The rank appending the last "done" line is the only one seeing them all
+  std::ifstream placement_file(file);
+  std::set<std::size_t> done_ranks;
+  std::string line;
+  while (std::getline(placement_file, line)) {
+    std::stringstream fields(line);
+    std::string type, line_run;
+    std::size_t done_rank;
+    if (fields >> type >> line_run >> done_rank && type == "done" &&
+        line_run == run && done_rank < n_ranks) {
+      done_ranks.insert(done_rank);
+    }
+  }
+  placement_file.close();
+
+  if (done_ranks.size() == n_ranks) {
+    std::error_code ec;
+    std::filesystem::remove(file, ec);
+  }
+}
+
+std::string check_rank_placement(const std::vector<rank_placement>& placements,
+                                 std::size_t n_ranks,
+                                 std::size_t n_numa_nodes) {
+  std::vector<std::string> issues;
+  if (placements.size() < n_ranks) {
+    issues.push_back("only " + std::to_string(placements.size()) + " of " +
+                     std::to_string(n_ranks) +
+                     " rank(s) published their placement");
+  }
+
+  // Overlapping ranks, reported once with the number of overlapping pairs
+  std::string first_overlap;
+  std::size_t n_overlaps = 0;
+  for (std::size_t i = 0; i < placements.size(); i++) {
+    for (std::size_t j = i + 1; j < placements.size(); j++) {
+      std::vector<std::size_t> shared;
+      std::set_intersection(placements[i].cpus.begin(),
+                            placements[i].cpus.end(),
+                            placements[j].cpus.begin(),
+                            placements[j].cpus.end(),
+                            std::back_inserter(shared));
+      if (!shared.empty() && n_overlaps++ == 0) {
+        first_overlap = "ranks " + std::to_string(placements[i].rank) +
+                        " and " + std::to_string(placements[j].rank) +
+                        " share CPUs " + format_cpu_list(shared);
+      }
+    }
+  }
+  if (n_overlaps > 0) {
+    issues.push_back(first_overlap + " (" + std::to_string(n_overlaps) +
+                     " overlapping pair(s))");
+  }
+
+  std::vector<std::size_t> oversubscribed, multi_node;
+  std::size_t min_cpus = -1, max_cpus = 0;
+  std::size_t min_threads = -1, max_threads = 0;
+  std::map<std::size_t, std::size_t> ranks_per_node;
+  for (const rank_placement& placement : placements) {
+    min_threads = std::min(min_threads, placement.concurrency);
+    max_threads = std::max(max_threads, placement.concurrency);
+    if (placement.cpus.empty()) {
+      continue;
+    }
+
+    min_cpus = std::min(min_cpus, placement.cpus.size());
+    max_cpus = std::max(max_cpus, placement.cpus.size());
+    if (placement.concurrency > placement.cpus.size()) {
+      oversubscribed.push_back(placement.rank);
+    }
+    if (placement.numa_nodes.size() == 1) {
+      ranks_per_node[placement.numa_nodes[0]]++;
+    } else if (placement.numa_nodes.size() > 1) {
+      multi_node.push_back(placement.rank);
+    }
+  }
+
+  if (!oversubscribed.empty()) {
+    issues.push_back("ranks " + format_cpu_list(oversubscribed) +
+                     " run more threads than they have CPUs");
+  }
+  if (min_cpus < max_cpus) {
+    issues.push_back("uneven CPU counts (" + std::to_string(min_cpus) +
+                     " to " + std::to_string(max_cpus) + ")");
+  }
+  if (!placements.empty() && min_threads < max_threads) {
+    issues.push_back("uneven Kokkos concurrency (" +
+                     std::to_string(min_threads) + " to " +
+                     std::to_string(max_threads) + ")");
+  }
+
+  // With at least one rank per NUMA node, every rank should stay on a single
+  // node and the nodes should get the same number of ranks
+  if (n_numa_nodes > 1 && placements.size() >= n_numa_nodes) {
+    if (!multi_node.empty()) {
+      issues.push_back("ranks " + format_cpu_list(multi_node) +
+                       " span several NUMA nodes");
+    }
+    std::size_t min_ranks = ranks_per_node.size() < n_numa_nodes ? 0 : -1;
+    std::size_t max_ranks = 0;
+    for (const auto& [node, count] : ranks_per_node) {
+      min_ranks = std::min(min_ranks, count);
+      max_ranks = std::max(max_ranks, count);
+    }
+    if (multi_node.empty() && max_ranks > min_ranks + 1) {
+      issues.push_back("uneven ranks per NUMA node (" +
+                       std::to_string(min_ranks) + " to " +
+                       std::to_string(max_ranks) + ")");
+    }
+  }
+
+  std::stringstream ss;
+  if (issues.empty()) {
+    std::vector<std::size_t> all_cpus;
+    for (const rank_placement& placement : placements) {
+      all_cpus.insert(all_cpus.end(), placement.cpus.begin(),
+                      placement.cpus.end());
+    }
+    std::sort(all_cpus.begin(), all_cpus.end());
+    ss << "OK: " << placements.size() << " rank(s) on " << all_cpus.size()
+       << " CPU(s), no overlap";
+    return ss.str();
+  }
+
+  ss << "WARNING: ";
+  for (std::size_t i = 0; i < issues.size(); i++) {
+    ss << (i == 0 ? "" : ", ") << issues[i];
+  }
+  return ss.str();
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+rank_placement get_rank_placement(std::size_t rank) {
+  rank_placement placement;
+  placement.rank = rank;
+#if defined(_WIN32)
+  placement.pid = static_cast<long>(GetCurrentProcessId());
+#else
+  placement.pid = static_cast<long>(getpid());
+#endif
+  placement.concurrency = Kokkos::DefaultHostExecutionSpace().concurrency();
+  placement.cpus        = get_process_cpus();
+
+  for (const numa_node& node : get_numa_nodes()) {
+    if (std::any_of(placement.cpus.begin(), placement.cpus.end(),
+                    [&](std::size_t cpu) {
+                      return std::binary_search(node.cpus.begin(),
+                                                node.cpus.end(), cpu);
+                    })) {
+      placement.numa_nodes.push_back(node.id);
+    }
+  }
+  return placement;
+}
+
+std::vector<rank_placement> exchange_rank_placement(std::size_t rank,
+                                                    std::size_t n_ranks,
+                                                    const std::string& file,
+                                                    double timeout) {
+  const std::string run = impl::get_placement_run_id();
+  impl::publish_rank_placement(file, run, get_rank_placement(rank));
+  std::vector<rank_placement> placements =
+      impl::collect_rank_placements(file, run, n_ranks, timeout);
+  impl::release_rank_placements(file, run, rank, n_ranks);
+  return placements;
+}
+
+std::string check_rank_placement(const std::vector<rank_placement>& placements,
+                                 std::size_t n_ranks) {
+  return impl::check_rank_placement(placements, n_ranks,
+                                    get_numa_nodes().size());
+}
+
+void print_rank_placement(const std::vector<rank_placement>& placements,
+                          std::size_t n_ranks, std::ostream& ostream) {
+  ostream << "RANK PLACEMENT (" << placements.size() << " of " << n_ranks
+          << " rank(s)):\n";
+  for (const rank_placement& placement : placements) {
+    ostream << "- Rank " << placement.rank << " (pid " << placement.pid
+            << "): " << placement.concurrency << " thread(s) on CPUs "
+            << (placement.cpus.empty()
+                    ? "N/A"
+                    : impl::format_cpu_list(placement.cpus))
+            << ", NUMA node(s) "
+            << (placement.numa_nodes.empty()
+                    ? "N/A"
+                    : impl::format_cpu_list(placement.numa_nodes))
+            << '\n';
+  }
+  ostream << "- Check: " << check_rank_placement(placements, n_ranks)
+          << std::endl;
+}
+
+void print_node_placement(std::ostream& ostream) {
+  impl::local_rank local =
+      impl::get_local_rank().value_or(impl::local_rank{0, 1});
+  std::vector<rank_placement> placements =
+      exchange_rank_placement(local.rank, local.size);
+  if (local.rank == 0) {
+    print_rank_placement(placements, local.size, ostream);
+  }
+}
+
+}  // namespace cexa
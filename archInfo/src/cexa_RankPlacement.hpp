@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_RANK_PLACEMENT_HPP
+#define CEXA_RANK_PLACEMENT_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Placement of one process (rank) of a multi-process launch on its node
+struct rank_placement {
+  // Rank among the processes of the node
+  std::size_t rank = 0;
+  long pid         = 0;
+  // Kokkos host concurrency
+  std::size_t concurrency = 0;
+  // Affinity mask of the process, empty if unknown
+  std::vector<std::size_t> cpus;
+  // NUMA nodes holding these CPUs
+  std::vector<std::size_t> numa_nodes;
+};
+
+// Placement of the calling process
+rank_placement get_rank_placement(std::size_t rank);
+
+namespace impl {
+
+struct local_rank {
+  std::size_t rank;
+  std::size_t size;
+};
+
+// Node local rank and number of ranks set by the launcher (Slurm, Open MPI,
+// MPICH, Intel MPI, Cray PALS), nullopt if none is found
+std::optional<local_rank> get_local_rank();
+
+// Identifier of the launch shared by the ranks of a node: the job and step ids
+// of the launcher and the start time of the parent process. The placement
+// files only hold lines of the same run
+std::string get_placement_run_id();
+
+// CEXA_PLACEMENT_FILE if set, otherwise a file of /dev/shm (or of the
+// temporary directory) named after the parent process, which all the ranks
+// of a node share under the usual launchers
+std::string get_default_placement_file();
+
+// One line per rank, appended in a single write so that concurrent ranks do
+// not interleave
+void publish_rank_placement(const std::string& file, const std::string& run,
+                            const rank_placement& placement);
+// Waits up to timeout seconds for n_ranks ranks to publish their placement,
+// the result is sorted by rank and may be incomplete
+std::vector<rank_placement> collect_rank_placements(const std::string& file,
+                                                    const std::string& run,
+                                                    std::size_t n_ranks,
+                                                    double timeout);
+// Marks rank as done with file, the last of the n_ranks ranks removes it
+void release_rank_placements(const std::string& file, const std::string& run,
+                             std::size_t rank, std::size_t n_ranks);
+
+std::string check_rank_placement(const std::vector<rank_placement>& placements,
+                                 std::size_t n_ranks, std::size_t n_numa_nodes);
+
+}  // namespace impl
+
+// Publishes the placement of the calling process to file, a file shared by
+// the ranks of the node, and returns the placement of the n_ranks ranks once
+// they all published theirs (or after timeout seconds). Every rank of the node
+// must call it
+std::vector<rank_placement> exchange_rank_placement(
+    std::size_t rank, std::size_t n_ranks,
+    const std::string& file = impl::get_default_placement_file(),
+    double timeout          = 10.);
+
+// One line diagnostic starting with "OK" or "WARNING": missing ranks, ranks
+// sharing CPUs, more threads than CPUs, uneven numbers of CPUs or threads, or
+// ranks unevenly spread over the NUMA nodes
+std::string check_rank_placement(const std::vector<rank_placement>& placements,
+                                 std::size_t n_ranks);
+
+void print_rank_placement(const std::vector<rank_placement>& placements,
+                          std::size_t n_ranks,
+                          std::ostream& ostream = std::cout);
+
+// exchange_rank_placement with the local rank of the launcher, then prints the
+// placement table on the local rank 0. Every rank of the node must call it
+void print_node_placement(std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_RANK_PLACEMENT_HPP
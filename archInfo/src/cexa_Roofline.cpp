@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include "cexa_Roofline.hpp"
+#include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
+
+#include <cstdlib>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace cexa::impl {
+
+roofline_sizes get_roofline_sizes(std::size_t concurrency) {
+  // Per CPU share of each cache level, with fallbacks for when the caches are
+  // unknown
+  std::size_t l1 = 32 << 10, l2 = 1 << 20, l3 = 4 << 20;
+  for (const cache_info& cache : get_cpu_caches()) {
+    if (cache.type == "Instruction") {
+      continue;
+    }
+    std::size_t share = cache.size / std::max<std::size_t>(
+                                         cache.shared_cpus.size(), 1);
+    if (cache.level == 1) l1 = share;
+    if (cache.level == 2) l2 = share;
+    if (cache.level == 3) l3 = share;
+  }
+
+  roofline_sizes sizes;
+  sizes.l1 = l1 / 2 * concurrency;
+  sizes.l2 = l2 / 2 * concurrency;
+  sizes.l3 = l3 / 2 * concurrency;
+  // Large enough to defeat the caches of the whole machine
+  sizes.dram = std::max<std::size_t>(
+      4 * l3 * std::thread::hardware_concurrency(), std::size_t(512) << 20);
+  return sizes;
+}
+
+std::string get_roofline_cache_key(const std::string& execution_space,
+                                   std::size_t concurrency) {
+  // The binding of the OpenMP threads changes the caches and memory
+  // controllers they share
+  std::string binding;
+  for (const char* variable : {"OMP_PROC_BIND", "OMP_PLACES"}) {
+    const char* value = std::getenv(variable);
+    binding += std::string(value != nullptr ? value : "") + "|";
+  }
+  return get_cpu_model_name() + "|" + get_kernel_version() + "|" +
+         execution_space + "|" + std::to_string(concurrency) + "|" + binding +
+         "v" + std::to_string(roofline_version);
+}
+
+std::string get_default_roofline_cache_file() {
+  return get_user_cache_file("roofline");
+}
+
+// The cache entries are "<fp64> <fp32> <l1> <l2> <l3> <dram>"
+std::optional<roofline> load_roofline(const std::string& cache_file,
+                                      const std::string& key) {
+  std::optional<std::string> entry = load_cache_entry(cache_file, key);
+  if (!entry.has_value()) {
+    return std::nullopt;
+  }
+
+  roofline result;
+  std::stringstream values(entry.value());
+  if (values >> result.fp64_gflops >> result.fp32_gflops >>
+      result.l1_bandwidth >> result.l2_bandwidth >> result.l3_bandwidth >>
+      result.dram_bandwidth) {
+    return result;
+  }
+  return std::nullopt;
+}
+
+void save_roofline(const std::string& cache_file, const std::string& key,
+                   const roofline& result) {
+  std::stringstream values;
+  values << result.fp64_gflops << ' ' << result.fp32_gflops << ' '
+         << result.l1_bandwidth << ' ' << result.l2_bandwidth << ' '
+         << result.l3_bandwidth << ' ' << result.dram_bandwidth;
+  save_cache_entry(cache_file, key, values.str());
+}
+
+}  // namespace cexa::impl
+
+namespace cexa {
+
+void print_roofline(const roofline& result, std::ostream& ostream) {
+  ostream << "ROOFLINE (" << result.execution_space << "):\n"
+          << "- FP64 FMA: " << result.fp64_gflops << " GFlop/s\n"
+          << "- FP32 FMA: " << result.fp32_gflops << " GFlop/s\n"
+          << "- L1 bandwidth: " << result.l1_bandwidth << " GB/s\n"
+          << "- L2 bandwidth: " << result.l2_bandwidth << " GB/s\n"
+          << "- L3 bandwidth: " << result.l3_bandwidth << " GB/s\n"
+          << "- DRAM bandwidth: " << result.dram_bandwidth << " GB/s\n";
+
+  // The theoretical DRAM bandwidth is only known for the host memory
+  if (result.execution_space ==
+      Kokkos::DefaultHostExecutionSpace::name()) {
+    ostream << "- DRAM check: " << check_memory_bandwidth(result.dram_bandwidth)
+            << '\n';
+  }
+  ostream << std::flush;
+}
+
+}  // namespace cexa
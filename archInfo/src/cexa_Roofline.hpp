@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_ROOFLINE_HPP
+#define CEXA_ROOFLINE_HPP
+
+#include "cexa_ArchInfo.hpp"
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cexa {
+
+// Ceilings of the machine measured with Kokkos kernels
+struct roofline {
+  std::string execution_space;
+  // Fused multiply-add throughput, in GFlop/s
+  double fp64_gflops = 0.;
+  double fp32_gflops = 0.;
+  // Bandwidth of a b = s * a + b kernel, in GB/s, counting the load of a and
+  // the load and store of b. b is read before being written so there is no
+  // write allocate traffic
+  double l1_bandwidth   = 0.;
+  double l2_bandwidth   = 0.;
+  double l3_bandwidth   = 0.;
+  double dram_bandwidth = 0.;
+};
+
+namespace impl {
+
+// Increase it when the kernels change so that stale cached results are ignored
+constexpr int roofline_version = 1;
+
+struct roofline_sizes {
+  // Total size in bytes of the arrays used by each bandwidth measurement
+  std::size_t l1, l2, l3, dram;
+  // Bytes moved by each work item of the bandwidth kernels
+  std::size_t bytes_per_item = std::size_t(64) << 20;
+  // FMA per chain of the FMA kernels
+  int fma_iterations = 1 << 16;
+};
+
+// Working sets fitting in half of each cache level, given the share of the
+// caches of concurrency threads
+roofline_sizes get_roofline_sizes(std::size_t concurrency);
+
+// Cache entries are keyed by CPU model, kernel version, execution space, its
+// concurrency and the binding of the OpenMP threads (OMP_PROC_BIND and
+// OMP_PLACES)
+std::string get_roofline_cache_key(const std::string& execution_space,
+                                   std::size_t concurrency);
+// $XDG_CACHE_HOME/cexa/roofline, or ~/.cache/cexa/roofline. Empty if neither
+// variable is set
+std::string get_default_roofline_cache_file();
+std::optional<roofline> load_roofline(const std::string& cache_file,
+                                      const std::string& key);
+void save_roofline(const std::string& cache_file, const std::string& key,
+                   const roofline& result);
+
+// The kernels use the native simd ABI of the host, so only host execution
+// spaces are supported
+template <class ExecSpace>
+constexpr bool is_roofline_space =
+    Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                               typename ExecSpace::memory_space>::accessible;
+
+template <class T, class ExecSpace>
+double measure_fma_throughput(const ExecSpace& space, int n_iterations) {
+  static_assert(is_roofline_space<ExecSpace>,
+                "the roofline is only measured on host execution spaces");
+  using simd_type = Kokkos::Experimental::simd<T>;
+  // Enough independent chains to hide the latency of the FMA units
+  constexpr int n_chains    = 12;
+  const std::size_t n_items = 4 * space.concurrency();
+
+  Kokkos::View<simd_type*, typename ExecSpace::memory_space> result(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "cexa::roofline_fma"),
+      n_items);
+
+  double best_time = time_launches([&]() {
+    Kokkos::parallel_for(
+        "cexa::roofline_fma",
+        Kokkos::RangePolicy<ExecSpace>(space, 0, n_items),
+        [=](std::size_t i) {
+          const simd_type a(T(0.999999));
+          const simd_type b(T(1e-6));
+
+          simd_type acc[n_chains];
+          for (int c = 0; c < n_chains; c++) {
+            acc[c] = simd_type(T(i + c));
+          }
+          for (int it = 0; it < n_iterations; it++) {
+            for (int c = 0; c < n_chains; c++) {
+              acc[c] = Kokkos::fma(acc[c], a, b);
+            }
+          }
+
+          simd_type sum = acc[0];
+          for (int c = 1; c < n_chains; c++) {
+            sum = sum + acc[c];
+          }
+          result(i) = sum;
+        });
+  });
+
+  const double flops = 2. * simd_type::size() * n_chains * n_iterations *
+                       static_cast<double>(n_items);
+  return flops / best_time * 1e-9;
+}
+
+template <class ExecSpace>
+double measure_bandwidth(const ExecSpace& space, std::size_t working_set,
+                         std::size_t bytes_per_item) {
+  static_assert(is_roofline_space<ExecSpace>,
+                "the roofline is only measured on host execution spaces");
+  using simd_type = Kokkos::Experimental::simd<double>;
+  using view_type = Kokkos::View<simd_type*, typename ExecSpace::memory_space>;
+
+  // Every thread sweeps a contiguous chunk of the arrays that stays in its
+  // caches
+  const std::size_t n_items = space.concurrency();
+  const std::size_t chunk =
+      std::max<std::size_t>(working_set / (2 * sizeof(simd_type) * n_items), 1);
+  const std::size_t n_sweeps = std::max<std::size_t>(
+      bytes_per_item / (3 * sizeof(simd_type) * chunk), 1);
+
+  view_type a(Kokkos::view_alloc(space, "cexa::roofline_a"), chunk * n_items);
+  view_type b(Kokkos::view_alloc(space, "cexa::roofline_b"), chunk * n_items);
+
+  double best_time = time_launches([&]() {
+    Kokkos::parallel_for(
+        "cexa::roofline_bandwidth",
+        Kokkos::RangePolicy<ExecSpace>(space, 0, n_items),
+        [=](std::size_t i) {
+          const simd_type s(1e-3);
+          for (std::size_t sweep = 0; sweep < n_sweeps; sweep++) {
+            for (std::size_t k = 0; k < chunk; k++) {
+              std::size_t j = i * chunk + k;
+              b(j)          = Kokkos::fma(s, a(j), b(j));
+            }
+          }
+        });
+  });
+
+  // Two loads and one store per element
+  const double bytes = 3. * sizeof(simd_type) * chunk * n_sweeps *
+                       static_cast<double>(n_items);
+  return bytes / best_time * 1e-9;
+}
+
+template <class ExecSpace>
+roofline measure_roofline(const ExecSpace& space,
+                          const roofline_sizes& sizes) {
+  roofline result;
+  result.execution_space = ExecSpace::name();
+  result.fp64_gflops =
+      measure_fma_throughput<double>(space, sizes.fma_iterations);
+  result.fp32_gflops =
+      measure_fma_throughput<float>(space, sizes.fma_iterations);
+  result.l1_bandwidth =
+      measure_bandwidth(space, sizes.l1, sizes.bytes_per_item);
+  result.l2_bandwidth =
+      measure_bandwidth(space, sizes.l2, sizes.bytes_per_item);
+  result.l3_bandwidth =
+      measure_bandwidth(space, sizes.l3, sizes.bytes_per_item);
+  result.dram_bandwidth =
+      measure_bandwidth(space, sizes.dram, sizes.bytes_per_item);
+  return result;
+}
+
+}  // namespace impl
+
+// Runs the FMA and bandwidth probes on space, a host execution space, takes
+// about a second
+template <class ExecSpace = Kokkos::DefaultHostExecutionSpace>
+roofline measure_roofline(const ExecSpace& space = ExecSpace()) {
+  return impl::measure_roofline(
+      space, impl::get_roofline_sizes(space.concurrency()));
+}
+
+// Same as measure_roofline, but the result is cached in cache_file and reused
+// by later runs on the same kind of machine. An empty cache_file disables the
+// cache
+template <class ExecSpace = Kokkos::DefaultHostExecutionSpace>
+roofline get_roofline(
+    const ExecSpace& space        = ExecSpace(),
+    const std::string& cache_file = impl::get_default_roofline_cache_file()) {
+  static_assert(impl::is_roofline_space<ExecSpace>,
+                "the roofline is only measured on host execution spaces");
+  const std::string key =
+      impl::get_roofline_cache_key(ExecSpace::name(), space.concurrency());
+
+  if (!cache_file.empty()) {
+    std::optional<roofline> cached = impl::load_roofline(cache_file, key);
+    if (cached.has_value()) {
+      cached->execution_space = ExecSpace::name();
+      return cached.value();
+    }
+  }
+
+  roofline result = measure_roofline(space);
+  if (!cache_file.empty()) {
+    impl::save_roofline(cache_file, key, result);
+  }
+  return result;
+}
+
+void print_roofline(const roofline& result, std::ostream& ostream = std::cout);
+
+}  // namespace cexa
+
+#endif  // CEXA_ROOFLINE_HPP
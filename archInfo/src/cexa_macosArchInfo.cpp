@@ -4,6 +4,7 @@
 #if defined(__APPLE__)
 
 #include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
 
 #include <cstdint>
 #include <fstream>
@@ -82,6 +83,21 @@ std::optional<std::string> extract_plist_value(const std::string& line) {
   return line.substr(pos, end - pos);
 }
 
+// The SMBIOS tables and EDAC are not exposed
+std::vector<unsigned char> read_smbios_table() { return {}; }
+
+std::vector<memory_device> read_edac_memory_devices(const std::string&) {
+  return {};
+}
+
+// steady_clock is backed by mach_absolute_time
+std::string read_clocksource() { return "mach_absolute_time"; }
+
+// macOS does not expose the CPU a thread runs on
+int get_current_cpu() { return -1; }
+
+std::string get_cpu_model_name_without_lscpu() { return get_cpu_model_name(); }
+
 }  // namespace cexa::impl
 
 namespace cexa {
@@ -98,10 +114,93 @@ std::size_t get_thread_count_per_socket() {
   return impl::get_sysctl_int("machdep.cpu.logical_per_package").value_or(-1);
 }
 
+// Apple machines are single socket UMA systems and no NUMA information is
+// exposed
+std::vector<numa_node> get_numa_nodes() { return {}; }
+
+// The cache sharing is not exposed
+std::vector<std::vector<std::size_t>> get_llc_domains() { return {}; }
+
+std::vector<std::vector<std::size_t>> get_cpu_clusters() { return {}; }
+
+// Apple silicon does not expose the MIDR to user space
+std::optional<arm_cpu_info> get_arm_cpu_info() { return std::nullopt; }
+
+// The SMT siblings are not exposed, but without SMT (Apple silicon) every
+// logical CPU is a core
+std::vector<cpu_core> get_cpu_cores() {
+  std::size_t n_cores   = impl::get_sysctl_int("hw.physicalcpu").value_or(0);
+  std::size_t n_threads = impl::get_sysctl_int("hw.logicalcpu").value_or(0);
+  if (n_cores != n_threads) {
+    return {};
+  }
+
+  std::vector<cpu_core> cores;
+  for (std::size_t cpu = 0; cpu < n_cores; cpu++) {
+    cores.push_back({0, cpu, {cpu}});
+  }
+  return cores;
+}
+
+std::string get_cpu_microcode_version() { return "N/A"; }
+
+// There are no affinity masks, only affinity tags hinting the scheduler
+std::vector<std::size_t> get_process_cpus() { return {}; }
+
+std::vector<std::string> get_cpu_features() {
+  std::vector<std::string> features;
+  auto add_feature = [&](const char* key, const char* name) {
+    if (impl::get_sysctl_int(key).value_or(0) != 0) {
+      features.push_back(name);
+    }
+  };
+  add_feature("hw.optional.avx1_0", "avx");
+  add_feature("hw.optional.avx2_0", "avx2");
+  add_feature("hw.optional.avx512f", "avx512f");
+  add_feature("hw.optional.AdvSIMD", "asimd");
+  return features;
+}
+
+std::vector<cache_info> get_cpu_caches() {
+  std::vector<cache_info> caches;
+  std::size_t line_size = impl::get_sysctl_int("hw.cachelinesize").value_or(0);
+
+  auto add_cache = [&](std::size_t level, const char* type, const char* key) {
+    std::optional<std::int64_t> size = impl::get_sysctl_int(key);
+    if (size.has_value() && size.value() > 0) {
+      caches.push_back({level, type, static_cast<std::size_t>(size.value()),
+                        line_size, {}});
+    }
+  };
+  add_cache(1, "Data", "hw.l1dcachesize");
+  add_cache(1, "Instruction", "hw.l1icachesize");
+  add_cache(2, "Unified", "hw.l2cachesize");
+  add_cache(3, "Unified", "hw.l3cachesize");
+  return caches;
+}
+
+// The frequency scaling settings are not exposed
+std::vector<cpu_frequency> get_cpu_frequencies() { return {}; }
+
+std::string get_cpu_boost_state() { return "N/A"; }
+
 std::string get_cpu_model_name() {
   return impl::get_sysctl_string("machdep.cpu.brand_string").value_or("ERROR");
 }
 
+// Only SMT can be derived on this system
+kernel_tunables get_kernel_tunables() {
+  kernel_tunables tunables{"N/A", "N/A", "N/A", "N/A",
+                           "N/A", "N/A", "N/A", "N/A"};
+  if (get_core_count_per_socket() != static_cast<std::size_t>(-1) &&
+      get_thread_count_per_socket() != static_cast<std::size_t>(-1)) {
+    tunables.smt_active =
+        get_thread_count_per_socket() > get_core_count_per_socket() ? "1"
+                                                                    : "0";
+  }
+  return tunables;
+}
+
 std::string get_sys_name() {
   // We have to read the values from this XML-like file. The file contains a
   // sequence of key and string XML nodes
@@ -4,14 +4,28 @@
 #if defined(UNIX) || defined(__unix__)
 
 #include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <cstring>
 #include <unordered_set>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
 
 namespace cexa::impl {
 
@@ -32,24 +46,19 @@ std::optional<std::string> get_proc_sys_value(const char* files) {
   return value;
 }
 
-struct cpu_topology {
-  std::size_t n_sockets          = static_cast<std::size_t>(-1);
-  std::size_t procs_per_socket   = static_cast<std::size_t>(-1);
-  std::size_t threads_per_socket = static_cast<std::size_t>(-1);
-};
-
-// Reads informations about the cpus from /sys/devices/system/cpu. This assumes
-// that we have read access to /sys/
+// Reads informations about the cpus from a Linux cpu directory
+// (/sys/devices/system/cpu). This assumes that we have read access to /sys/
 // NOTE: simpler alternatives would be:
 // - reading the values from /proc/cpuinfo (doesn't work on arm)
 // - use hwloc (requires hwloc to be installed on the system)
-cpu_topology init_cpu_topology() {
+cpu_topology read_cpu_topology(const std::string& cpu_dir) {
   namespace fs = std::filesystem;
 
   std::unordered_set<std::string> package_ids, core_ids;
   int n_threads = 0;
 
-  for (auto& entry : fs::directory_iterator("/sys/devices/system/cpu")) {
+  std::error_code ec;
+  for (auto& entry : fs::directory_iterator(cpu_dir, ec)) {
     if (!entry.is_directory()) {
       continue;
     }
@@ -85,6 +94,10 @@ cpu_topology init_cpu_topology() {
     core_ids.insert(socket_id + "_" + core_id);
   }
 
+  if (package_ids.empty()) {
+    return cpu_topology{};
+  }
+
   cpu_topology topo;
   topo.n_sockets          = package_ids.size();
   topo.procs_per_socket   = core_ids.size() / topo.n_sockets;
@@ -92,43 +105,367 @@ cpu_topology init_cpu_topology() {
   return topo;
 }
 
-static cpu_topology topology = init_cpu_topology();
+// Read on first use rather than when the library is loaded, so that programs
+// which never query the topology do not pay for it
+const cpu_topology& get_cpu_topology() {
+  static const cpu_topology topology =
+      read_cpu_topology("/sys/devices/system/cpu");
+  return topology;
+}
+
+std::vector<numa_node> read_numa_nodes(const std::string& node_dir) {
+  namespace fs = std::filesystem;
+
+  std::vector<numa_node> nodes;
+  std::error_code ec;
+  for (auto& entry : fs::directory_iterator(node_dir, ec)) {
+    // we only want to iterate the node0, node1, ... directories
+    std::string name = entry.path().filename().string();
+    if (name.find("node") != 0 || name.size() < 5 || !std::isdigit(name[4])) {
+      continue;
+    }
+
+    numa_node node;
+    node.id = std::stoul(name.substr(4));
+
+    std::ifstream cpu_list_file(entry.path() / "cpulist");
+    std::string cpu_list;
+    std::getline(cpu_list_file, cpu_list);
+    node.cpus = parse_cpu_list(cpu_list);
+
+    std::ifstream distance_file(entry.path() / "distance");
+    std::size_t distance;
+    while (distance_file >> distance) {
+      node.distances.push_back(distance);
+    }
+
+    nodes.push_back(node);
+  }
+
+  std::sort(nodes.begin(), nodes.end(),
+            [](const numa_node& a, const numa_node& b) { return a.id < b.id; });
+  return nodes;
+}
+
+std::vector<cache_info> read_cpu_caches(const std::string& cpu_dir) {
+  namespace fs = std::filesystem;
+
+  std::vector<cache_info> caches;
+  std::error_code ec;
+  for (auto& entry : fs::directory_iterator(cpu_dir + "/cpu0/cache", ec)) {
+    // we only want to iterate the index0, index1, ... directories
+    std::string name = entry.path().filename().string();
+    if (name.find("index") != 0) {
+      continue;
+    }
+
+    cache_info cache;
+    std::ifstream level_file(entry.path() / "level");
+    std::ifstream type_file(entry.path() / "type");
+    if (!(level_file >> cache.level) || !(type_file >> cache.type)) {
+      continue;
+    }
+
+    // The size is given in KiB, with a "K" suffix
+    std::ifstream size_file(entry.path() / "size");
+    std::string size;
+    size_file >> size;
+    cache.size = size.empty() ? 0 : std::stoul(size);
+    if (!size.empty() && size.back() == 'K') {
+      cache.size *= 1024;
+    } else if (!size.empty() && size.back() == 'M') {
+      cache.size *= 1024 * 1024;
+    }
+
+    std::ifstream line_size_file(entry.path() / "coherency_line_size");
+    if (!(line_size_file >> cache.line_size)) {
+      cache.line_size = 0;
+    }
+
+    std::ifstream shared_cpu_file(entry.path() / "shared_cpu_list");
+    std::string shared_cpu_list;
+    std::getline(shared_cpu_file, shared_cpu_list);
+    cache.shared_cpus = parse_cpu_list(shared_cpu_list);
+
+    caches.push_back(cache);
+  }
+
+  std::sort(caches.begin(), caches.end(),
+            [](const cache_info& a, const cache_info& b) {
+              return a.level < b.level ||
+                     (a.level == b.level && a.type < b.type);
+            });
+  return caches;
+}
+
+// Iterates the cpu0, cpu1, ... directories of cpu_dir
+template <class F>
+void for_each_cpu_dir(const std::string& cpu_dir, F&& f) {
+  namespace fs = std::filesystem;
+
+  std::error_code ec;
+  for (auto& entry : fs::directory_iterator(cpu_dir, ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.find("cpu") != 0 || name.size() < 4 || !std::isdigit(name[3])) {
+      continue;
+    }
+    f(std::stoul(name.substr(3)), entry.path());
+  }
+}
+
+std::vector<cpu_core> read_cpu_cores(const std::string& cpu_dir) {
+  // Keyed by (socket, core id)
+  std::map<std::pair<std::size_t, std::size_t>, cpu_core> cores;
+
+  for_each_cpu_dir(cpu_dir, [&](std::size_t cpu,
+                                const std::filesystem::path& path) {
+    std::ifstream package_id_file(path / "topology" / "physical_package_id");
+    std::ifstream core_id_file(path / "topology" / "core_id");
+    cpu_core core;
+    if (!(package_id_file >> core.socket) || !(core_id_file >> core.id)) {
+      return;
+    }
+
+    cpu_core& entry = cores.try_emplace({core.socket, core.id}, core)
+                          .first->second;
+    entry.cpus.push_back(cpu);
+  });
+
+  std::vector<cpu_core> result;
+  for (auto& [key, core] : cores) {
+    std::sort(core.cpus.begin(), core.cpus.end());
+    result.push_back(core);
+  }
+  std::sort(result.begin(), result.end(),
+            [](const cpu_core& a, const cpu_core& b) {
+              return a.socket < b.socket ||
+                     (a.socket == b.socket && a.cpus[0] < b.cpus[0]);
+            });
+  return result;
+}
+
+std::vector<std::vector<std::size_t>> read_llc_domains(
+    const std::string& cpu_dir) {
+  std::set<std::vector<std::size_t>> domains;
+  // The CPUs of a domain share its cache directories, only one of them is read
+  std::unordered_set<std::size_t> covered_cpus;
+
+  for_each_cpu_dir(cpu_dir, [&](std::size_t cpu,
+                                const std::filesystem::path& path) {
+    if (covered_cpus.count(cpu)) {
+      return;
+    }
+
+    // The last level cache is the one with the highest level, e.g. the L3 of
+    // a CCX on AMD or the L2 of a cluster on some Arm CPUs
+    std::size_t llc_level = 0;
+    std::string llc_cpu_list;
+    std::error_code ec;
+    for (auto& entry :
+         std::filesystem::directory_iterator(path / "cache", ec)) {
+      std::ifstream level_file(entry.path() / "level");
+      std::ifstream type_file(entry.path() / "type");
+      std::size_t level;
+      std::string type;
+      if (!(level_file >> level) || !(type_file >> type) ||
+          type == "Instruction" || level <= llc_level) {
+        continue;
+      }
+
+      std::ifstream shared_cpu_file(entry.path() / "shared_cpu_list");
+      llc_level = level;
+      llc_cpu_list.clear();
+      std::getline(shared_cpu_file, llc_cpu_list);
+    }
+
+    std::vector<std::size_t> cpus = parse_cpu_list(llc_cpu_list);
+    if (!cpus.empty()) {
+      covered_cpus.insert(cpus.begin(), cpus.end());
+      domains.insert(cpus);
+    }
+  });
+
+  // std::set sorts the domains by first CPU
+  return std::vector<std::vector<std::size_t>>(domains.begin(), domains.end());
+}
+
+std::vector<std::vector<std::size_t>> read_cpu_clusters(
+    const std::string& cpu_dir) {
+  // Keyed by (socket, cluster id), cluster ids are unique within a socket only
+  std::map<std::pair<std::size_t, long>, std::vector<std::size_t>> clusters;
+
+  for_each_cpu_dir(cpu_dir, [&](std::size_t cpu,
+                                const std::filesystem::path& path) {
+    std::ifstream package_id_file(path / "topology" / "physical_package_id");
+    std::ifstream cluster_id_file(path / "topology" / "cluster_id");
+    std::size_t socket;
+    long cluster_id;
+    if ((package_id_file >> socket) && (cluster_id_file >> cluster_id) &&
+        cluster_id >= 0) {
+      clusters[{socket, cluster_id}].push_back(cpu);
+    }
+  });
+
+  std::set<std::vector<std::size_t>> sorted_clusters;
+  for (auto& [key, cpus] : clusters) {
+    std::sort(cpus.begin(), cpus.end());
+    sorted_clusters.insert(cpus);
+  }
+  return std::vector<std::vector<std::size_t>>(sorted_clusters.begin(),
+                                               sorted_clusters.end());
+}
+
+std::optional<std::uint32_t> read_midr(const std::string& cpu_dir) {
+  // "0x00000000410fd4f0", only the lower 32 bits are defined
+  std::ifstream file(cpu_dir + "/cpu0/regs/identification/midr_el1");
+  std::string midr;
+  if (!(file >> midr)) {
+    return std::nullopt;
+  }
+  std::optional<long long> value = parse_integer(midr, 16);
+  if (!value.has_value()) {
+    return std::nullopt;
+  }
+  return static_cast<std::uint32_t>(value.value());
+}
+
+std::vector<cpu_frequency> read_cpu_frequencies(const std::string& cpu_dir) {
+  namespace fs = std::filesystem;
+
+  // Frequencies are given in kHz
+  auto read_mhz = [](const fs::path& file) {
+    std::ifstream stream(file);
+    double frequency = 0.;
+    return (stream >> frequency) ? frequency / 1000. : 0.;
+  };
+  auto read_str = [](const fs::path& file) {
+    std::ifstream stream(file);
+    std::string value;
+    stream >> value;
+    return value;
+  };
+
+  std::vector<cpu_frequency> frequencies;
+  std::error_code ec;
+  for (auto& entry : fs::directory_iterator(cpu_dir, ec)) {
+    // we only want to iterate the cpu0, cpu1, ... directories
+    std::string name = entry.path().filename().string();
+    if (name.find("cpu") != 0 || name.size() < 4 || !std::isdigit(name[3])) {
+      continue;
+    }
+
+    fs::path cpufreq = entry.path() / "cpufreq";
+    if (!fs::exists(cpufreq, ec)) {
+      continue;
+    }
+
+    cpu_frequency frequency;
+    frequency.cpu          = std::stoul(name.substr(3));
+    frequency.current      = read_mhz(cpufreq / "scaling_cur_freq");
+    frequency.min          = read_mhz(cpufreq / "scaling_min_freq");
+    frequency.max          = read_mhz(cpufreq / "scaling_max_freq");
+    frequency.hardware_max = read_mhz(cpufreq / "cpuinfo_max_freq");
+    frequency.governor     = read_str(cpufreq / "scaling_governor");
+    frequency.energy_performance_preference =
+        read_str(cpufreq / "energy_performance_preference");
+    frequencies.push_back(frequency);
+  }
+
+  std::sort(frequencies.begin(), frequencies.end(),
+            [](const cpu_frequency& a, const cpu_frequency& b) {
+              return a.cpu < b.cpu;
+            });
+  return frequencies;
+}
+
+std::vector<unsigned char> read_smbios_table() {
+  std::ifstream file("/sys/firmware/dmi/tables/DMI", std::ios::binary);
+  return std::vector<unsigned char>(std::istreambuf_iterator<char>(file),
+                                    std::istreambuf_iterator<char>());
+}
+
+std::vector<memory_device> read_edac_memory_devices(
+    const std::string& edac_dir) {
+  namespace fs = std::filesystem;
+
+  std::vector<memory_device> devices;
+  std::error_code ec;
+  for (auto& controller : fs::directory_iterator(edac_dir, ec)) {
+    if (controller.path().filename().string().find("mc") != 0) {
+      continue;
+    }
+
+    // dimm* directories, or rank* on older kernels
+    for (auto& entry : fs::directory_iterator(controller.path(), ec)) {
+      std::string name = entry.path().filename().string();
+      if (name.find("dimm") != 0 && name.find("rank") != 0) {
+        continue;
+      }
+
+      memory_device device;
+      std::ifstream size_file(entry.path() / "size");
+      if (!(size_file >> device.size)) {
+        continue;
+      }
+      // The size is given in MiB
+      device.size <<= 20;
+
+      std::ifstream label_file(entry.path() / "dimm_label");
+      std::getline(label_file, device.locator);
+
+      // e.g. "Registered-DDR4"
+      std::ifstream type_file(entry.path() / "dimm_mem_type");
+      std::getline(type_file, device.type);
+      device.type = device.type.substr(device.type.find('-') + 1);
+
+      devices.push_back(device);
+    }
+  }
+  return devices;
+}
+
+std::string read_clocksource() {
+  std::ifstream file(
+      "/sys/devices/system/clocksource/clocksource0/current_clocksource");
+  std::string clocksource;
+  return file >> clocksource ? clocksource : "N/A";
+}
+
+int get_current_cpu() {
+#if defined(__linux__)
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
 
 #if defined(__aarch64__) || defined(__arm__)
 
 std::optional<std::string> read_cpu_model_lscpu() {
-  static const char* model_name_key = "Model name";
+  static const std::string model_name_key = "Model name:";
 
   // "lscpu --parse=MODELNAME" Not available on GH200
-  FILE* f = popen("lscpu | head -n 32 2>/dev/null", "r");
+  FILE* f = popen("lscpu 2>/dev/null", "r");
   if (!f) {
     return std::nullopt;
   }
 
   // We don't expect cpu model names to be longer that 1024 characters
   char buffer[1024];
-  char* pos = nullptr;
-
-  while (pos == nullptr) {
-    if (!std::fgets(buffer, 1024, f)) {
-      pclose(f);
-      return std::nullopt;
+  std::optional<std::string> model_name;
+  while (std::fgets(buffer, 1024, f)) {
+    // Skip the key and whitespace. Heterogeneous CPUs list one model name per
+    // core type, keep the first one
+    std::string line(buffer);
+    if (!model_name.has_value() && line.rfind(model_name_key, 0) == 0) {
+      std::size_t begin = line.find_first_not_of(" \t", model_name_key.size());
+      std::size_t end   = line.find_last_not_of(" \t\n");
+      if (begin != std::string::npos && end >= begin) {
+        model_name = line.substr(begin, end - begin + 1);
+      }
     }
-    pos = std::strstr(buffer, model_name_key);
-  }
-
-  // Skip key and whitespace
-  pos += std::strlen(model_name_key) + 1;
-  while (std::isspace(*pos)) {
-    pos++;
   }
-
-  std::string model_name(pos);
   pclose(f);
-
-  if (model_name.back() == '\n') {
-    model_name.pop_back();
-  }
   return model_name;
 }
 
@@ -163,79 +500,359 @@ std::optional<std::string> read_cpu_model_lscpu() {
 
 #endif
 
-// Extract a value from /proc/cpuinfo
-std::optional<std::string> get_cpu_info_str(const char* key) {
-  std::ifstream cpu_info("/proc/cpuinfo");
-
-  if (!cpu_info.is_open()) {
-    return std::nullopt;
+std::optional<std::string> get_snapshot_value(const std::string& key);
+
+// Reads the values of one source of the snapshot, keyed by "<source><name>"
+snapshot_values read_snapshot_source(const std::string& source) {
+  snapshot_values values;
+
+  if (source == "cpuinfo/") {
+    // Only the first processor, the file is several hundred KiB on large nodes
+    std::ifstream cpu_info("/proc/cpuinfo");
+    read_key_values(cpu_info, ':', source, true, values);
+  } else if (source == "os-release/") {
+    std::ifstream os_release("/etc/os-release");
+    read_key_values(os_release, '=', source, false, values);
+    for (auto& [key, value] : values) {
+      if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+      }
+    }
+  } else if (source == "kernel/") {
+    for (const char* name : {"ostype", "osrelease"}) {
+      std::optional<std::string> value =
+          get_proc_sys_value(("kernel/" + std::string(name)).c_str());
+      if (value.has_value()) {
+        values[source + name] = value.value();
+      }
+    }
+  } else if (source == "cpu/") {
+    // NOTE: /proc/cpuinfo on arm does not provide the CPU model name, it is
+    // decoded from the MIDR when the part is known
+#if !defined(__aarch64__) && !defined(__arm__)
+    // The "model name" of /proc/cpuinfo is what lscpu prints on x86
+    std::optional<std::string> cpu_model =
+        get_snapshot_value("cpuinfo/model name");
+    if (cpu_model.has_value()) {
+      values[source + "model"] = cpu_model.value();
+    }
+#else
+    std::optional<std::uint32_t> midr = read_midr("/sys/devices/system/cpu");
+    if (!midr.has_value()) {
+      auto field = [](const char* name) {
+        return get_snapshot_value("cpuinfo/" + std::string(name)).value_or("");
+      };
+      midr = make_midr(field("CPU implementer"), field("CPU variant"),
+                       field("CPU part"), field("CPU revision"));
+    }
+    if (midr.has_value()) {
+      values[source + "midr"] = std::to_string(midr.value());
+      arm_cpu_info info       = decode_midr(midr.value());
+      if (info.part_name != "Unknown") {
+        values[source + "model"] = info.vendor + ' ' + info.part_name;
+      }
+    }
+#endif
+  } else if (source == "lscpu/") {
+    // lscpu seems to be reliable, but starting it costs tens of milliseconds,
+    // so it is only run when the cpu source does not give the model name
+    std::optional<std::string> cpu_model = read_cpu_model_lscpu();
+    if (cpu_model.has_value()) {
+      values[source + "model"] = cpu_model.value();
+    }
   }
 
-  std::string value;
-  std::string name;
+  return values;
+}
+
+// Recursive, reading the cpu source queries the cpuinfo one
+std::recursive_mutex& get_system_snapshot_mutex() {
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
+struct system_snapshot {
+  snapshot_values values;
+  std::string cache_file;
+  std::string boot_id;
+};
 
-  while (std::getline(cpu_info, name, ':')) {
-    if (name.find(key) == 0) {
-      if (std::isspace(cpu_info.peek())) {
-        cpu_info.get();
+// Each source is read on the first query of one of its keys, and served from
+// memory afterwards. When enabled, the values are also shared between the
+// processes of a node through a cache file, until the next boot. The caller
+// must hold the mutex
+system_snapshot& get_system_snapshot(const std::string& source) {
+  static system_snapshot snapshot = [] {
+    system_snapshot init;
+    init.boot_id = get_proc_sys_value("kernel/random/boot_id").value_or("");
+    if (!init.boot_id.empty()) {
+      init.cache_file = get_snapshot_cache_file(
+          get_proc_sys_value("kernel/hostname").value_or("") + "." +
+          init.boot_id);
+    }
+    if (!init.cache_file.empty()) {
+      init.values = load_snapshot(init.cache_file, init.boot_id)
+                        .value_or(snapshot_values());
+    }
+    return init;
+  }();
+
+  // An empty "<source>" entry marks the sources already read
+  if (!source.empty() && !snapshot.values.count(source)) {
+    snapshot_values values = read_snapshot_source(source);
+    values[source]         = "";
+    if (!snapshot.cache_file.empty()) {
+      // Keeps the sources written by the other processes meanwhile
+      snapshot_values cached =
+          load_snapshot(snapshot.cache_file, snapshot.boot_id)
+              .value_or(snapshot_values());
+      cached.insert(snapshot.values.begin(), snapshot.values.end());
+      for (const auto& [name, value] : values) {
+        cached[name] = value;
       }
-      std::getline(cpu_info, value);
-      return value;
+      snapshot.values = cached;
+      save_snapshot(snapshot.cache_file, snapshot.boot_id, snapshot.values);
+    } else {
+      snapshot.values.insert(values.begin(), values.end());
     }
-    std::getline(cpu_info, value);
   }
-
-  return std::nullopt;
+  return snapshot;
 }
 
-// Extract a value from /etc/os-release
-std::optional<std::string> get_os_release_str(const char* key) {
-  std::ifstream os_release_file("/etc/os-release");
+// Value of a "<source>/<name>" key of the snapshot
+std::optional<std::string> get_snapshot_value(const std::string& key) {
+  std::lock_guard<std::recursive_mutex> lock(get_system_snapshot_mutex());
+  const snapshot_values& values =
+      get_system_snapshot(key.substr(0, key.find('/') + 1)).values;
 
-  if (!os_release_file.is_open()) {
+  auto value = values.find(key);
+  if (value == values.end() || value->second.empty()) {
     return std::nullopt;
   }
+  return value->second;
+}
 
-  std::string value;
-  std::string name;
-
-  while (std::getline(os_release_file, name, '=')) {
-    std::getline(os_release_file, value);
-    if (name == key) {
-      if (value.front() == '"' && value.back() == '"') {
-        return value.substr(1, value.size() - 2);
-      }
-      return value;
+// Value of a field of the first processor of /proc/cpuinfo, the first field
+// whose name starts with key if there is no exact match
+std::optional<std::string> get_cpu_info_str(const char* key) {
+  std::lock_guard<std::recursive_mutex> lock(get_system_snapshot_mutex());
+  const snapshot_values& values = get_system_snapshot("cpuinfo/").values;
+
+  const std::string prefix = "cpuinfo/" + std::string(key);
+  for (auto value = values.lower_bound(prefix);
+       value != values.end() && value->first.rfind(prefix, 0) == 0; value++) {
+    if (!value->second.empty()) {
+      return value->second;
     }
   }
-
   return std::nullopt;
 }
 
+// Value of a field of /etc/os-release
+std::optional<std::string> get_os_release_str(const char* key) {
+  return get_snapshot_value("os-release/" + std::string(key));
+}
+
+std::string get_cpu_model_name_without_lscpu() {
+  std::optional<std::string> cpu_model = get_snapshot_value("cpu/model");
+  if (!cpu_model.has_value()) {
+    cpu_model = get_cpu_info_str("model name");
+  }
+  return cpu_model.value_or("Unknown");
+}
+
 }  // namespace cexa::impl
 
 namespace cexa {
 
-std::size_t get_physical_socket_count() { return impl::topology.n_sockets; }
+std::size_t get_physical_socket_count() {
+  return impl::get_cpu_topology().n_sockets;
+}
 
 std::size_t get_core_count_per_socket() {
-  return impl::topology.procs_per_socket;
+  return impl::get_cpu_topology().procs_per_socket;
 }
 
 std::size_t get_thread_count_per_socket() {
-  return impl::topology.threads_per_socket;
+  return impl::get_cpu_topology().threads_per_socket;
+}
+
+std::vector<cpu_frequency> get_cpu_frequencies() {
+  // Not cached, the current frequency changes
+  return impl::read_cpu_frequencies("/sys/devices/system/cpu");
+}
+
+std::string get_cpu_boost_state() {
+  // acpi-cpufreq and amd-pstate expose "boost", intel_pstate "no_turbo"
+  std::ifstream boost_file("/sys/devices/system/cpu/cpufreq/boost");
+  int value;
+  if (boost_file >> value) {
+    return value ? "enabled" : "disabled";
+  }
+
+  std::ifstream no_turbo_file("/sys/devices/system/cpu/intel_pstate/no_turbo");
+  if (no_turbo_file >> value) {
+    return value ? "disabled" : "enabled";
+  }
+
+  return "N/A";
+}
+
+std::vector<numa_node> get_numa_nodes() {
+  static const std::vector<numa_node> nodes =
+      impl::read_numa_nodes("/sys/devices/system/node");
+  return nodes;
+}
+
+std::string get_cpu_microcode_version() {
+  // NOTE: not exposed on arm
+  return impl::get_cpu_info_str("microcode").value_or("N/A");
+}
+
+std::vector<std::string> get_cpu_features() {
+  // x86 lists them in "flags", arm in "Features"
+  std::optional<std::string> cpu_flags = impl::get_cpu_info_str("flags");
+  if (!cpu_flags.has_value()) {
+    cpu_flags = impl::get_cpu_info_str("Features");
+  }
+  std::stringstream flags(cpu_flags.value_or(""));
+  std::vector<std::string> features;
+  std::string feature;
+  while (flags >> feature) {
+    features.push_back(feature);
+  }
+  return features;
+}
+
+std::vector<cache_info> get_cpu_caches() {
+  static const std::vector<cache_info> caches =
+      impl::read_cpu_caches("/sys/devices/system/cpu");
+  return caches;
+}
+
+std::vector<cpu_core> get_cpu_cores() {
+  static const std::vector<cpu_core> cores =
+      impl::read_cpu_cores("/sys/devices/system/cpu");
+  return cores;
 }
 
+std::vector<std::size_t> get_process_cpus() {
+#if defined(__linux__)
+  // Sized for the configured CPUs, which may exceed CPU_SETSIZE
+  const int n_cpus =
+      std::max<int>(sysconf(_SC_NPROCESSORS_CONF), CPU_SETSIZE);
+
+  const std::size_t set_size = CPU_ALLOC_SIZE(n_cpus);
+  cpu_set_t* set             = CPU_ALLOC(n_cpus);
+
+  std::vector<std::size_t> cpus;
+  if (sched_getaffinity(0, set_size, set) == 0) {
+    for (int cpu = 0; cpu < n_cpus; cpu++) {
+      if (CPU_ISSET_S(cpu, set_size, set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  CPU_FREE(set);
+  return cpus;
+#else
+  return {};
+#endif
+}
+
+std::vector<std::vector<std::size_t>> get_llc_domains() {
+  static const std::vector<std::vector<std::size_t>> domains =
+      impl::read_llc_domains("/sys/devices/system/cpu");
+  return domains;
+}
+
+std::vector<std::vector<std::size_t>> get_cpu_clusters() {
+  static const std::vector<std::vector<std::size_t>> clusters =
+      impl::read_cpu_clusters("/sys/devices/system/cpu");
+  return clusters;
+}
+
+std::optional<arm_cpu_info> get_arm_cpu_info() {
+  // A malformed cached value is treated as an unknown MIDR
+  std::optional<std::string> midr = impl::get_snapshot_value("cpu/midr");
+  std::optional<long long> midr_value =
+      midr.has_value() ? impl::parse_integer(midr.value()) : std::nullopt;
+  if (!midr_value.has_value()) {
+    return std::nullopt;
+  }
+
+  arm_cpu_info info =
+      impl::decode_midr(static_cast<std::uint32_t>(midr_value.value()));
+  for (const std::string& feature : get_cpu_features()) {
+    info.sve  = info.sve || feature == "sve";
+    info.sve2 = info.sve2 || feature == "sve2";
+  }
+#if defined(__aarch64__) && defined(PR_SVE_GET_VL)
+  // Length in bytes in the lower bits, the other bits are flags
+  const int vector_length = prctl(PR_SVE_GET_VL);
+  if (info.sve && vector_length > 0) {
+    info.sve_vector_length = 8 * (vector_length & PR_SVE_VL_LEN_MASK);
+  }
+#endif
+  return info;
+}
+
+// Falls back to lscpu, then to the raw /proc/cpuinfo field
 std::string get_cpu_model_name() {
-  // NOTE: /proc/cpuinfo on arm does not provide the CPU model name, lscpu on
-  // the other hand seems to be reliable. If it fails we fall back to reading
-  // from /proc/cpuinfo
-  std::optional<std::string> cpu_model = impl::read_cpu_model_lscpu();
-  if (cpu_model.has_value()) {
-    return cpu_model.value();
-  } else {
-    return impl::get_cpu_info_str("model name").value_or("Unknown");
+  std::optional<std::string> cpu_model = impl::get_snapshot_value("cpu/model");
+  if (!cpu_model.has_value()) {
+    cpu_model = impl::get_snapshot_value("lscpu/model");
+  }
+  if (!cpu_model.has_value()) {
+    cpu_model = impl::get_cpu_info_str("model name");
+  }
+  return cpu_model.value_or("Unknown");
+}
+
+kernel_tunables get_kernel_tunables() {
+  auto read_sys_value = [](const char* path) {
+    std::ifstream file(path);
+    std::string value;
+    std::getline(file, value);
+    return value.empty() ? std::string("N/A") : value;
+  };
+
+  kernel_tunables tunables;
+  tunables.numa_balancing =
+      impl::get_proc_sys_value("kernel/numa_balancing").value_or("N/A");
+  tunables.zone_reclaim_mode =
+      impl::get_proc_sys_value("vm/zone_reclaim_mode").value_or("N/A");
+  tunables.overcommit_memory =
+      impl::get_proc_sys_value("vm/overcommit_memory").value_or("N/A");
+  tunables.perf_event_paranoid =
+      impl::get_proc_sys_value("kernel/perf_event_paranoid").value_or("N/A");
+
+  // Moved to debugfs in Linux 5.13, only read when the sysctl is missing
+  std::optional<std::string> migration_cost =
+      impl::get_proc_sys_value("kernel/sched_migration_cost_ns");
+  tunables.sched_migration_cost_ns =
+      migration_cost.has_value()
+          ? migration_cost.value()
+          : read_sys_value("/sys/kernel/debug/sched/migration_cost_ns");
+  std::optional<std::string> nr_migrate =
+      impl::get_proc_sys_value("kernel/sched_nr_migrate");
+  tunables.sched_nr_migrate =
+      nr_migrate.has_value()
+          ? nr_migrate.value()
+          : read_sys_value("/sys/kernel/debug/sched/nr_migrate");
+
+  // The active mode is in brackets: "always [madvise] never"
+  tunables.transparent_hugepage =
+      read_sys_value("/sys/kernel/mm/transparent_hugepage/enabled");
+  std::size_t open  = tunables.transparent_hugepage.find('[');
+  std::size_t close = tunables.transparent_hugepage.find(']');
+  if (open != std::string::npos && close != std::string::npos) {
+    tunables.transparent_hugepage =
+        tunables.transparent_hugepage.substr(open + 1, close - open - 1);
   }
+
+  tunables.smt_active = read_sys_value("/sys/devices/system/cpu/smt/active");
+  return tunables;
 }
 
 std::string get_sys_name() {
@@ -243,11 +860,11 @@ std::string get_sys_name() {
 }
 
 std::string get_sys_type() {
-  return impl::get_proc_sys_value("kernel/ostype").value_or("Unknown");
+  return impl::get_snapshot_value("kernel/ostype").value_or("Unknown");
 }
 
 std::string get_kernel_version() {
-  return impl::get_proc_sys_value("kernel/osrelease").value_or("Unknown");
+  return impl::get_snapshot_value("kernel/osrelease").value_or("Unknown");
 }
 
 }  // namespace cexa
@@ -4,8 +4,11 @@
 #if defined(_WIN32)
 
 #include "cexa_ArchInfo.hpp"
+#include "cexa_ArchInfoImpl.hpp"
 
+#include <algorithm>
 #include <bit>
+#include <cstdio>
 #include <optional>
 #include <string>
 #include <array>
@@ -50,6 +53,68 @@ std::optional<T> read_registry_value(std::string_view path,
   return value;
 }
 
+// Logical CPUs of a group affinity, numbered as group * 64 + bit
+std::vector<std::size_t> get_affinity_cpus(const GROUP_AFFINITY& affinity) {
+  std::vector<std::size_t> cpus;
+  for (std::size_t bit = 0; bit < 64; bit++) {
+    if (affinity.Mask & (KAFFINITY(1) << bit)) {
+      cpus.push_back(affinity.Group * 64 + bit);
+    }
+  }
+  return cpus;
+}
+
+// Calls f on every entry of GetLogicalProcessorInformationEx(relation)
+template <class F>
+void for_each_processor_info(LOGICAL_PROCESSOR_RELATIONSHIP relation, F&& f) {
+  DWORD length = 0;
+  GetLogicalProcessorInformationEx(relation, nullptr, &length);
+  std::vector<std::byte> proc_info(length);
+  if (!GetLogicalProcessorInformationEx(
+          relation, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)proc_info.data(),
+          &length)) {
+    return;
+  }
+
+  for (std::size_t i = 0; i < length;) {
+    PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX info =
+        reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(
+            proc_info.data() + i);
+    i += info->Size;
+    f(*info);
+  }
+}
+
+std::vector<unsigned char> read_smbios_table() {
+  // The table is preceded by the 8 bytes of the RawSMBIOSData header
+  constexpr std::size_t header_size = 8;
+  UINT size = GetSystemFirmwareTable('RSMB', 0, nullptr, 0);
+  std::vector<unsigned char> buffer(size);
+  if (size <= header_size ||
+      GetSystemFirmwareTable('RSMB', 0, buffer.data(), size) != size) {
+    return {};
+  }
+  return std::vector<unsigned char>(buffer.begin() + header_size,
+                                    buffer.end());
+}
+
+// EDAC is specific to Linux
+std::vector<memory_device> read_edac_memory_devices(const std::string&) {
+  return {};
+}
+
+// steady_clock is backed by QueryPerformanceCounter, itself based on the TSC
+// when it is invariant
+std::string read_clocksource() { return "QueryPerformanceCounter"; }
+
+int get_current_cpu() {
+  PROCESSOR_NUMBER proc_number;
+  GetCurrentProcessorNumberEx(&proc_number);
+  return proc_number.Group * 64 + proc_number.Number;
+}
+
+std::string get_cpu_model_name_without_lscpu() { return get_cpu_model_name(); }
+
 }  // namespace cexa::impl
 
 namespace cexa {
@@ -136,6 +201,257 @@ std::size_t get_thread_count_per_socket() {
   return -1;
 }
 
+// Windows does not expose the distances between nodes
+std::vector<numa_node> get_numa_nodes() {
+  std::vector<numa_node> nodes;
+
+  ULONG highest_node = 0;
+  if (!GetNumaHighestNodeNumber(&highest_node)) {
+    return nodes;
+  }
+
+  for (USHORT node_id = 0; node_id <= highest_node; node_id++) {
+    GROUP_AFFINITY affinity;
+    if (!GetNumaNodeProcessorMaskEx(node_id, &affinity)) {
+      continue;
+    }
+
+    numa_node node;
+    node.id = node_id;
+    for (std::size_t bit = 0; bit < 64; bit++) {
+      if (affinity.Mask & (KAFFINITY(1) << bit)) {
+        node.cpus.push_back(affinity.Group * 64 + bit);
+      }
+    }
+    nodes.push_back(node);
+  }
+  return nodes;
+}
+
+std::string get_cpu_microcode_version() {
+  // The "Update Revision" registry value holds the revision in its upper 32
+  // bits
+  std::optional<ULONGLONG> revision = impl::read_registry_value<ULONGLONG>(
+      "HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0",
+      "Update Revision");
+  if (!revision) {
+    return "N/A";
+  }
+
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "0x%llx", revision.value() >> 32);
+  return buffer;
+}
+
+// Only the extensions checked against the Kokkos architecture are reported,
+// the newest constants are missing from older SDKs
+std::vector<std::string> get_cpu_features() {
+  std::vector<std::string> features;
+  auto add_feature = [&](DWORD feature, const char* name) {
+    if (IsProcessorFeaturePresent(feature)) {
+      features.push_back(name);
+    }
+  };
+#if defined(PF_AVX_INSTRUCTIONS_AVAILABLE)
+  add_feature(PF_AVX_INSTRUCTIONS_AVAILABLE, "avx");
+  add_feature(PF_AVX2_INSTRUCTIONS_AVAILABLE, "avx2");
+  add_feature(PF_AVX512F_INSTRUCTIONS_AVAILABLE, "avx512f");
+#endif
+  add_feature(PF_ARM_NEON_INSTRUCTIONS_AVAILABLE, "asimd");
+#if defined(PF_ARM_SVE_INSTRUCTIONS_AVAILABLE)
+  add_feature(PF_ARM_SVE_INSTRUCTIONS_AVAILABLE, "sve");
+  add_feature(PF_ARM_SVE2_INSTRUCTIONS_AVAILABLE, "sve2");
+#endif
+  return features;
+}
+
+// A process spanning several processor groups (the default since Windows 11
+// with more than 64 CPUs) has no affinity mask, it runs on every active CPU of
+// its groups
+std::vector<std::size_t> get_process_cpus() {
+  USHORT n_groups = 1;
+  std::vector<USHORT> groups(n_groups);
+  if (!GetProcessGroupAffinity(GetCurrentProcess(), &n_groups,
+                               groups.data())) {
+    // n_groups was set to the number of groups of the process
+    groups.resize(n_groups);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER ||
+        !GetProcessGroupAffinity(GetCurrentProcess(), &n_groups,
+                                 groups.data())) {
+      return {};
+    }
+  }
+  groups.resize(n_groups);
+
+  if (groups.size() == 1) {
+    DWORD_PTR process_mask = 0, system_mask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask,
+                                &system_mask)) {
+      return {};
+    }
+
+    GROUP_AFFINITY affinity{};
+    affinity.Mask  = process_mask;
+    affinity.Group = groups[0];
+    return impl::get_affinity_cpus(affinity);
+  }
+
+  std::vector<std::size_t> cpus;
+  for (USHORT group : groups) {
+    const DWORD n_cpus = GetActiveProcessorCount(group);
+
+    GROUP_AFFINITY affinity{};
+    affinity.Mask =
+        n_cpus >= 64 ? ~KAFFINITY(0) : (KAFFINITY(1) << n_cpus) - 1;
+    affinity.Group = group;
+    std::vector<std::size_t> group_cpus = impl::get_affinity_cpus(affinity);
+    cpus.insert(cpus.end(), group_cpus.begin(), group_cpus.end());
+  }
+  std::sort(cpus.begin(), cpus.end());
+  return cpus;
+}
+
+std::vector<cpu_core> get_cpu_cores() {
+  std::vector<std::vector<std::size_t>> packages;
+  impl::for_each_processor_info(
+      RelationProcessorPackage,
+      [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+        std::vector<std::size_t> cpus;
+        for (WORD i = 0; i < info.Processor.GroupCount; i++) {
+          std::vector<std::size_t> group_cpus =
+              impl::get_affinity_cpus(info.Processor.GroupMask[i]);
+          cpus.insert(cpus.end(), group_cpus.begin(), group_cpus.end());
+        }
+        packages.push_back(cpus);
+      });
+
+  std::vector<cpu_core> cores;
+  impl::for_each_processor_info(
+      RelationProcessorCore,
+      [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+        cpu_core core;
+        core.id   = cores.size();
+        core.cpus = impl::get_affinity_cpus(info.Processor.GroupMask[0]);
+        if (core.cpus.empty()) {
+          return;
+        }
+
+        core.socket = 0;
+        for (std::size_t i = 0; i < packages.size(); i++) {
+          if (std::find(packages[i].begin(), packages[i].end(),
+                        core.cpus[0]) != packages[i].end()) {
+            core.socket = i;
+          }
+        }
+        cores.push_back(core);
+      });
+
+  std::sort(cores.begin(), cores.end(),
+            [](const cpu_core& a, const cpu_core& b) {
+              return a.socket < b.socket ||
+                     (a.socket == b.socket && a.cpus[0] < b.cpus[0]);
+            });
+  return cores;
+}
+
+std::vector<std::vector<std::size_t>> get_llc_domains() {
+  // Keep only the caches of the highest level
+  std::vector<std::vector<std::size_t>> domains;
+  BYTE llc_level = 0;
+  impl::for_each_processor_info(
+      RelationCache, [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+        if (info.Cache.Type == CacheInstruction ||
+            info.Cache.Level < llc_level) {
+          return;
+        }
+        if (info.Cache.Level > llc_level) {
+          llc_level = info.Cache.Level;
+          domains.clear();
+        }
+        domains.push_back(impl::get_affinity_cpus(info.Cache.GroupMask));
+      });
+
+  std::sort(domains.begin(), domains.end());
+  domains.erase(std::unique(domains.begin(), domains.end()), domains.end());
+  return domains;
+}
+
+std::vector<std::vector<std::size_t>> get_cpu_clusters() {
+  // A processor module is a cluster of cores sharing an L2 or a front end
+  std::vector<std::vector<std::size_t>> clusters;
+  impl::for_each_processor_info(
+      RelationProcessorModule,
+      [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+        std::vector<std::size_t> cpus;
+        for (WORD i = 0; i < info.Processor.GroupCount; i++) {
+          std::vector<std::size_t> group_cpus =
+              impl::get_affinity_cpus(info.Processor.GroupMask[i]);
+          cpus.insert(cpus.end(), group_cpus.begin(), group_cpus.end());
+        }
+        if (!cpus.empty()) {
+          clusters.push_back(cpus);
+        }
+      });
+
+  std::sort(clusters.begin(), clusters.end());
+  return clusters;
+}
+
+// The MIDR is only exposed through the registry on Windows on Arm
+std::optional<arm_cpu_info> get_arm_cpu_info() { return std::nullopt; }
+
+std::vector<cache_info> get_cpu_caches() {
+  DWORD length = 0;
+  GetLogicalProcessorInformationEx(RelationCache, nullptr, &length);
+  std::vector<std::byte> proc_info(length);
+  if (!GetLogicalProcessorInformationEx(
+          RelationCache,
+          (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)proc_info.data(),
+          &length)) {
+    return {};
+  }
+
+  std::vector<cache_info> caches;
+  for (std::size_t i = 0; i < length;) {
+    PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX info =
+        reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(
+            proc_info.data() + i);
+    i += info->Size;
+
+    // Only keep the caches seen by the first CPU
+    const CACHE_RELATIONSHIP& cache = info->Cache;
+    if (cache.GroupMask.Group != 0 || !(cache.GroupMask.Mask & 1)) {
+      continue;
+    }
+
+    cache_info entry;
+    entry.level     = cache.Level;
+    entry.size      = cache.CacheSize;
+    entry.line_size = cache.LineSize;
+    entry.type      = cache.Type == CacheData          ? "Data"
+                      : cache.Type == CacheInstruction ? "Instruction"
+                                                       : "Unified";
+    for (std::size_t bit = 0; bit < 64; bit++) {
+      if (cache.GroupMask.Mask & (KAFFINITY(1) << bit)) {
+        entry.shared_cpus.push_back(bit);
+      }
+    }
+    caches.push_back(entry);
+  }
+
+  std::sort(caches.begin(), caches.end(),
+            [](const cache_info& a, const cache_info& b) {
+              return a.level < b.level ||
+                     (a.level == b.level && a.type < b.type);
+            });
+  return caches;
+}
+
+// The frequency scaling settings are not exposed
+std::vector<cpu_frequency> get_cpu_frequencies() { return {}; }
+
+std::string get_cpu_boost_state() { return "N/A"; }
+
 std::string get_cpu_model_name() {
   std::optional<std::string> cpu_model_name =
       impl::read_registry_value<std::string>(
@@ -145,6 +461,19 @@ std::string get_cpu_model_name() {
   return cpu_model_name.value_or("ERROR");
 }
 
+// Only SMT can be derived on this system
+kernel_tunables get_kernel_tunables() {
+  kernel_tunables tunables{"N/A", "N/A", "N/A", "N/A",
+                           "N/A", "N/A", "N/A", "N/A"};
+  if (get_core_count_per_socket() != static_cast<std::size_t>(-1) &&
+      get_thread_count_per_socket() != static_cast<std::size_t>(-1)) {
+    tunables.smt_active =
+        get_thread_count_per_socket() > get_core_count_per_socket() ? "1"
+                                                                    : "0";
+  }
+  return tunables;
+}
+
 std::string get_sys_name() {
   std::optional<std::string> sys_name = impl::read_registry_value<std::string>(
       "SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion", "ProductName");
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+// Cost of the archInfo getters, cold (first call in a new process) and warm
+// (later calls), and of the sysfs readers on fake trees of up to 1024 CPUs.
+// Exits with 1 if a measurement exceeds its budget. The budgets can be scaled
+// for slow machines with --budget-scale=<factor>
+
+#include <Kokkos_Core.hpp>
+#include <cexa_ArchInfo.hpp>
+#include <cexa_ArchInfoImpl.hpp>
+#include <cexa_FakeSysfs.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace {
+
+// Keeps the results of the getters alive
+volatile std::size_t sink = 0;
+
+struct getter {
+  const char* name;
+  std::function<std::size_t()> call;
+  // In milliseconds
+  double cold_budget;
+  double warm_budget;
+};
+
+std::vector<getter> get_getters() {
+  auto print = [](void (*print_info)(std::ostream&)) {
+    return [print_info] {
+      std::stringstream stream;
+      print_info(stream);
+      return stream.str().size();
+    };
+  };
+
+  // The cold budgets include the system snapshot (/proc/cpuinfo,
+  // /etc/os-release, ...) for the getters reading it first
+  return {
+      {"get_kokkos_concurrency", [] { return cexa::get_kokkos_concurrency(); },
+       1., 0.1},
+      {"get_cpu_model_name", [] { return cexa::get_cpu_model_name().size(); },
+       50., 0.1},
+      {"get_physical_socket_count",
+       [] { return cexa::get_physical_socket_count(); }, 50., 0.1},
+      {"get_core_count_per_socket",
+       [] { return cexa::get_core_count_per_socket(); }, 50., 0.1},
+      {"get_thread_count_per_socket",
+       [] { return cexa::get_thread_count_per_socket(); }, 50., 0.1},
+      {"get_cpu_microcode_version",
+       [] { return cexa::get_cpu_microcode_version().size(); }, 50., 0.1},
+      {"get_cpu_features", [] { return cexa::get_cpu_features().size(); },
+       50., 0.5},
+      {"get_arm_cpu_info",
+       [] { return std::size_t(cexa::get_arm_cpu_info().has_value()); }, 50.,
+       0.5},
+      {"get_cpu_caches", [] { return cexa::get_cpu_caches().size(); }, 20.,
+       0.1},
+      {"get_cpu_cores", [] { return cexa::get_cpu_cores().size(); }, 50., 0.5},
+      {"get_process_cpus", [] { return cexa::get_process_cpus().size(); }, 5.,
+       0.5},
+      {"get_llc_domains", [] { return cexa::get_llc_domains().size(); }, 100.,
+       0.5},
+      {"get_cpu_clusters", [] { return cexa::get_cpu_clusters().size(); }, 50.,
+       0.5},
+      {"get_cpu_frequencies",
+       [] { return cexa::get_cpu_frequencies().size(); }, 100., 100.},
+      {"get_cpu_boost_state", [] { return cexa::get_cpu_boost_state().size(); },
+       10., 1.},
+      {"get_numa_nodes", [] { return cexa::get_numa_nodes().size(); }, 20.,
+       0.1},
+      {"get_kokkos_thread_binding",
+       [] { return cexa::get_kokkos_thread_binding().size(); }, 100., 20.},
+      {"get_memory_info", [] { return cexa::get_memory_info().devices.size(); },
+       100., 0.1},
+      {"get_timer_info",
+       [] { return std::size_t(cexa::get_timer_info().granularity); }, 200.,
+       0.1},
+      {"get_sys_name", [] { return cexa::get_sys_name().size(); }, 50., 0.1},
+      {"get_kernel_version", [] { return cexa::get_kernel_version().size(); },
+       50., 0.1},
+      {"get_kernel_tunables",
+       [] { return cexa::get_kernel_tunables().numa_balancing.size(); }, 10.,
+       5.},
+      // CUDA and NVML initialization alone take hundreds of milliseconds
+      {"get_gpu_name", [] { return cexa::get_gpu_name().size(); }, 2000., 50.},
+      {"get_kokkos_config",
+       [] { return cexa::get_kokkos_config().backends.size(); }, 10., 1.},
+      {"print_os_info", print(cexa::print_os_info), 100., 10.},
+      {"print_host_info", print(cexa::print_host_info), 500., 200.},
+      {"print_kokkos_info", print(cexa::print_kokkos_info), 50., 5.},
+  };
+}
+
+double time_ms(const std::function<std::size_t()>& call) {
+  const auto begin = std::chrono::steady_clock::now();
+  sink             = sink + call();
+  const auto end   = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+double median_ms(const std::function<std::size_t()>& call, int n_runs) {
+  std::vector<double> times;
+  for (int i = 0; i < n_runs; i++) {
+    times.push_back(time_ms(call));
+  }
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+// Runs "program --cold name", which prints the time of the first call of the
+// getter in a new process. -1 if it fails
+double measure_cold(const std::string& program, const std::string& name) {
+  FILE* f = popen(('"' + program + "\" --cold " + name).c_str(), "r");
+  if (!f) {
+    return -1.;
+  }
+  double time = -1.;
+  if (std::fscanf(f, "%lf", &time) != 1) {
+    time = -1.;
+  }
+  pclose(f);
+  return time;
+}
+
+struct result {
+  std::string name;
+  double cold;
+  double cold_budget;
+  double warm;
+  double warm_budget;
+};
+
+#if defined(__linux__)
+namespace fs = std::filesystem;
+
+// The sysfs readers on fake trees, whose budgets grow with the number of CPUs
+std::vector<result> measure_fake_sysfs(double budget_scale) {
+  std::vector<result> results;
+  for (std::size_t n_cpus : {64, 256, 1024}) {
+    fs::path root = fs::temp_directory_path() /
+                    ("cexa_startup_benchmark_" + std::to_string(n_cpus));
+    fs::remove_all(root);
+    cexa::test::make_fake_sysfs(root, n_cpus);
+    const std::string cpu_dir  = (root / "cpu").string();
+    const std::string node_dir = (root / "node").string();
+
+    const std::vector<std::pair<const char*, std::function<std::size_t()>>>
+        readers = {
+            {"read_cpu_topology",
+             [&] {
+               return cexa::impl::read_cpu_topology(cpu_dir).n_sockets;
+             }},
+            {"read_cpu_caches",
+             [&] { return cexa::impl::read_cpu_caches(cpu_dir).size(); }},
+            {"read_cpu_cores",
+             [&] { return cexa::impl::read_cpu_cores(cpu_dir).size(); }},
+            {"read_llc_domains",
+             [&] { return cexa::impl::read_llc_domains(cpu_dir).size(); }},
+            {"read_cpu_clusters",
+             [&] { return cexa::impl::read_cpu_clusters(cpu_dir).size(); }},
+            {"read_cpu_frequencies",
+             [&] { return cexa::impl::read_cpu_frequencies(cpu_dir).size(); }},
+            {"read_numa_nodes",
+             [&] { return cexa::impl::read_numa_nodes(node_dir).size(); }}};
+
+    // Reading a handful of small files per CPU takes tens of microseconds,
+    // starting a process per CPU would take milliseconds
+    const double budget = budget_scale * (2. + 0.1 * n_cpus);
+    for (const auto& [name, call] : readers) {
+      const double cold = time_ms(call);
+      results.push_back({std::string(name) + " (" + std::to_string(n_cpus) +
+                             " CPUs)",
+                         cold, budget, median_ms(call, 5), budget});
+    }
+    fs::remove_all(root);
+  }
+  return results;
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Kokkos::ScopeGuard kokkos_scope(argc, argv);
+
+  double budget_scale = 1.;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--cold" && i + 1 < argc) {
+      // Child process: time the first call of one getter
+      for (const getter& getter : get_getters()) {
+        if (getter.name == std::string(argv[i + 1])) {
+          std::cout << time_ms(getter.call) << std::endl;
+          return 0;
+        }
+      }
+      return 1;
+    }
+    if (arg.rfind("--budget-scale=", 0) == 0) {
+      budget_scale = std::stod(arg.substr(15));
+    }
+  }
+
+  std::vector<result> results;
+  for (const getter& getter : get_getters()) {
+    const double cold = measure_cold(argv[0], getter.name);
+    time_ms(getter.call);
+    results.push_back({getter.name, cold, budget_scale * getter.cold_budget,
+                       median_ms(getter.call, 10),
+                       budget_scale * getter.warm_budget});
+  }
+#if defined(__linux__)
+  std::vector<result> sysfs_results = measure_fake_sysfs(budget_scale);
+  results.insert(results.end(), sysfs_results.begin(), sysfs_results.end());
+#endif
+
+  std::cout << std::left << std::setw(40) << "Function" << std::right
+            << std::setw(12) << "Cold (ms)" << std::setw(12) << "Budget"
+            << std::setw(12) << "Warm (ms)" << std::setw(12) << "Budget"
+            << '\n'
+            << std::fixed << std::setprecision(3);
+  int n_regressions = 0;
+  for (const result& result : results) {
+    const bool failed = result.cold < 0. || result.cold > result.cold_budget ||
+                        result.warm > result.warm_budget;
+    n_regressions += failed;
+    std::cout << std::left << std::setw(40) << result.name << std::right
+              << std::setw(12) << result.cold << std::setw(12)
+              << result.cold_budget << std::setw(12) << result.warm
+              << std::setw(12) << result.warm_budget
+              << (failed ? "  OVER BUDGET" : "") << '\n';
+  }
+
+  std::cout << n_regressions << " function(s) over budget" << std::endl;
+  return n_regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
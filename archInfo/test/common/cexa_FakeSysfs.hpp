@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+// Fake sysfs trees shared by the unit tests and the startup benchmark
+
+#ifndef CEXA_FAKE_SYSFS_HPP
+#define CEXA_FAKE_SYSFS_HPP
+
+#include <cexa_ArchInfoImpl.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace cexa::test {
+
+// Fake /sys/devices/system/{cpu,node} of a node with 2 sockets, 2 SMT threads
+// per core, clusters of 4 cores, an L3 per 16 cores and 4 NUMA nodes. CPU i
+// and i + n_cpus / 2 are the threads of a core
+inline void make_fake_sysfs(const std::filesystem::path& root,
+                            std::size_t n_cpus) {
+  namespace fs = std::filesystem;
+  const std::size_t n_cores = n_cpus / 2;
+
+  auto core_range = [&](std::size_t first_core, std::size_t size) {
+    std::vector<std::size_t> cpus;
+    for (std::size_t core = first_core; core < first_core + size; core++) {
+      cpus.push_back(core);
+      cpus.push_back(core + n_cores);
+    }
+    return cexa::impl::format_cpu_list(cpus);
+  };
+
+  for (std::size_t cpu = 0; cpu < n_cpus; cpu++) {
+    const std::size_t core = cpu % n_cores;
+    fs::path cpu_dir       = root / "cpu" / ("cpu" + std::to_string(cpu));
+
+    fs::create_directories(cpu_dir / "topology");
+    std::ofstream(cpu_dir / "topology" / "physical_package_id")
+        << core / (n_cores / 2) << '\n';
+    std::ofstream(cpu_dir / "topology" / "core_id") << core << '\n';
+    std::ofstream(cpu_dir / "topology" / "cluster_id") << core / 4 << '\n';
+
+    // L1d, L1i, L2 and L3
+    const std::string caches[][4] = {
+        {"1", "Data", "48K", core_range(core, 1)},
+        {"1", "Instruction", "32K", core_range(core, 1)},
+        {"2", "Unified", "2048K", core_range(core, 1)},
+        {"3", "Unified", "32768K", core_range(core / 16 * 16, 16)}};
+    for (std::size_t i = 0; i < std::size(caches); i++) {
+      fs::path index = cpu_dir / "cache" / ("index" + std::to_string(i));
+      fs::create_directories(index);
+      std::ofstream(index / "level") << caches[i][0] << '\n';
+      std::ofstream(index / "type") << caches[i][1] << '\n';
+      std::ofstream(index / "size") << caches[i][2] << '\n';
+      std::ofstream(index / "coherency_line_size") << "64\n";
+      std::ofstream(index / "shared_cpu_list") << caches[i][3] << '\n';
+    }
+
+    fs::path cpufreq = cpu_dir / "cpufreq";
+    fs::create_directories(cpufreq);
+    for (const char* file : {"scaling_cur_freq", "scaling_min_freq",
+                             "scaling_max_freq", "cpuinfo_max_freq"}) {
+      std::ofstream(cpufreq / file) << "2400000\n";
+    }
+    std::ofstream(cpufreq / "scaling_governor") << "performance\n";
+    std::ofstream(cpufreq / "energy_performance_preference") << "performance\n";
+  }
+
+  const std::size_t n_nodes = 4;
+  for (std::size_t node = 0; node < n_nodes; node++) {
+    fs::path node_dir = root / "node" / ("node" + std::to_string(node));
+    fs::create_directories(node_dir);
+    std::ofstream(node_dir / "cpulist")
+        << core_range(node * n_cores / n_nodes, n_cores / n_nodes) << '\n';
+    std::ofstream distance_file(node_dir / "distance");
+    for (std::size_t other = 0; other < n_nodes; other++) {
+      distance_file << (other == node ? 10 : 32) << ' ';
+    }
+  }
+}
+
+}  // namespace cexa::test
+
+#endif
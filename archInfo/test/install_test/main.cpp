@@ -10,4 +10,5 @@ int main(int argc, char* argv[]) {
   cexa::print_os_info();
   cexa::print_host_info();
   cexa::print_device_info();
+  cexa::print_kokkos_info();
 }
@@ -5,6 +5,31 @@
 #include <gtest/gtest.h>
 
 #include <cexa_ArchInfo.hpp>
+#include <cexa_ArchInfoImpl.hpp>
+#include <cexa_Autotune.hpp>
+#include <cexa_Energy.hpp>
+#include <cexa_FakeSysfs.hpp>
+#include <cexa_FirstTouch.hpp>
+#include <cexa_HugePages.hpp>
+#include <cexa_KernelCounters.hpp>
+#include <cexa_Noise.hpp>
+#include <cexa_RankPlacement.hpp>
+#include <cexa_Roofline.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <tuple>
+
+#if defined(__linux__)
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // OS
 TEST(ArchInfo, KernelVersion) {
@@ -15,6 +40,118 @@ TEST(ArchInfo, SysName) { ASSERT_GT(cexa::get_sys_name().size(), 0); }
 
 TEST(ArchInfo, SysType) { ASSERT_GT(cexa::get_sys_type().size(), 0); }
 
+TEST(ArchInfo, SystemSnapshot) {
+  // Repeated queries are served from the snapshot
+  ASSERT_EQ(cexa::get_sys_name(), cexa::get_sys_name());
+  ASSERT_EQ(cexa::get_cpu_model_name(), cexa::get_cpu_model_name());
+
+  std::string cache_file =
+      (std::filesystem::temp_directory_path() / "cexa_snapshot_test").string();
+  std::remove(cache_file.c_str());
+  ASSERT_FALSE(cexa::impl::load_snapshot(cache_file, "boot").has_value());
+
+  cexa::impl::snapshot_values values = {{"cpuinfo/model name", "CPU"},
+                                        {"os-release/NAME", "OS"}};
+  cexa::impl::save_snapshot(cache_file, "boot", values);
+  std::optional<cexa::impl::snapshot_values> cached =
+      cexa::impl::load_snapshot(cache_file, "boot");
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_EQ(cached.value(), values);
+
+  // Written by another boot
+  ASSERT_FALSE(cexa::impl::load_snapshot(cache_file, "reboot").has_value());
+
+  std::remove(cache_file.c_str());
+
+#if defined(__linux__)
+  // One file per host and boot, as the cache directory may be shared. Empty
+  // when neither XDG_CACHE_HOME nor HOME is set
+  setenv("CEXA_ARCHINFO_CACHE", "1", 1);
+  std::string node_1 = cexa::impl::get_snapshot_cache_file("node1.boot");
+  std::string node_2 = cexa::impl::get_snapshot_cache_file("node2.boot");
+  unsetenv("CEXA_ARCHINFO_CACHE");
+  if (!node_1.empty()) {
+    ASSERT_NE(node_1, node_2);
+  }
+  ASSERT_EQ(cexa::impl::get_snapshot_cache_file("node1.boot"), "");
+#endif
+}
+
+TEST(ArchInfo, SnapshotKeyValues) {
+  // Blank lines and comments are allowed anywhere in /etc/os-release
+  std::istringstream os_release(
+      "NAME=\"OS\"\n\n# comment\nVERSION_ID=\"1.0\"\nPRETTY_NAME=OS 1.0\n");
+  cexa::impl::snapshot_values values;
+  cexa::impl::read_key_values(os_release, '=', "os-release/", false, values);
+  ASSERT_EQ(values.size(), 3);
+  ASSERT_EQ(values["os-release/VERSION_ID"], "\"1.0\"");
+  ASSERT_EQ(values["os-release/PRETTY_NAME"], "OS 1.0");
+
+  // Only the first processor of /proc/cpuinfo
+  std::istringstream cpu_info(
+      "processor\t: 0\nmodel name\t: CPU 0\n\nprocessor\t: 1\n");
+  values.clear();
+  cexa::impl::read_key_values(cpu_info, ':', "cpuinfo/", true, values);
+  ASSERT_EQ(values.size(), 2);
+  ASSERT_EQ(values["cpuinfo/processor"], "0");
+  ASSERT_EQ(values["cpuinfo/model name"], "CPU 0");
+}
+
+TEST(ArchInfo, KernelTunables) {
+  cexa::kernel_tunables tunables = cexa::get_kernel_tunables();
+  ASSERT_GT(tunables.numa_balancing.size(), 0);
+  ASSERT_GT(tunables.transparent_hugepage.size(), 0);
+  ASSERT_GT(tunables.smt_active.size(), 0);
+
+  for (const std::string& issue : cexa::lint_host_performance()) {
+    ASSERT_GT(issue.size(), 0);
+  }
+}
+
+TEST(ArchInfo, PerformanceLint) {
+  cexa::kernel_tunables tunables{"0",      "0", "0", "500000", "32",
+                                 "always", "2", "0"};
+  ASSERT_TRUE(cexa::impl::lint_host_performance(tunables, 2, false).empty());
+
+  cexa::kernel_tunables numa_balancing = tunables;
+  numa_balancing.numa_balancing        = "1";
+  ASSERT_EQ(cexa::impl::lint_host_performance(numa_balancing, 2, false).size(),
+            1);
+  // Nothing to balance on a single node
+  ASSERT_TRUE(
+      cexa::impl::lint_host_performance(numa_balancing, 1, false).empty());
+
+  cexa::kernel_tunables smt = tunables;
+  smt.smt_active            = "1";
+  ASSERT_TRUE(cexa::impl::lint_host_performance(smt, 1, false).empty());
+  ASSERT_EQ(cexa::impl::lint_host_performance(smt, 1, true).size(), 1);
+
+  cexa::kernel_tunables unknown{"N/A", "N/A", "N/A", "N/A",
+                                "N/A", "N/A", "N/A", "N/A"};
+  ASSERT_TRUE(cexa::impl::lint_host_performance(unknown, 1, true).empty());
+
+  // Malformed sysctl values are skipped rather than thrown on, and Kokkos
+  // allocations can request huge pages with madvise
+  cexa::kernel_tunables malformed = tunables;
+
+  malformed.sched_migration_cost_ns = "fast";
+  malformed.perf_event_paranoid     = "999999999999999999999";
+  malformed.transparent_hugepage    = "madvise";
+  ASSERT_TRUE(cexa::impl::lint_host_performance(malformed, 1, true).empty());
+}
+
+TEST(ArchInfo, ParseInteger) {
+  ASSERT_EQ(cexa::impl::parse_integer(" 500000\n"), 500000);
+  ASSERT_EQ(cexa::impl::parse_integer("-1"), -1);
+  ASSERT_EQ(cexa::impl::parse_integer("ff", 16), 255);
+  ASSERT_EQ(cexa::impl::parse_integer("0x00000000410fd4f0", 16), 0x410fd4f0);
+  ASSERT_EQ(cexa::impl::parse_integer("0x41", 0), 0x41);
+  ASSERT_EQ(cexa::impl::parse_integer("10", 0), 10);
+  ASSERT_FALSE(cexa::impl::parse_integer("").has_value());
+  ASSERT_FALSE(cexa::impl::parse_integer("N/A").has_value());
+  ASSERT_FALSE(cexa::impl::parse_integer("12abc").has_value());
+}
+
 // CPU
 TEST(ArchInfo, CPUModelName) {
   ASSERT_GT(cexa::get_cpu_model_name().size(), 0);
@@ -30,6 +167,563 @@ TEST(ArchInfo, ThreadCountPerSocket) {
   ASSERT_GT(cexa::get_thread_count_per_socket(), 0);
 }
 
+TEST(ArchInfo, CPUCaches) {
+  for (const cexa::cache_info& cache : cexa::get_cpu_caches()) {
+    ASSERT_GT(cache.level, 0);
+    ASSERT_GT(cache.size, 0);
+  }
+}
+
+TEST(ArchInfo, CPUFrequencies) {
+  for (const cexa::cpu_frequency& frequency : cexa::get_cpu_frequencies()) {
+    ASSERT_LE(frequency.min, frequency.max);
+  }
+
+  std::string check = cexa::check_cpu_frequency_scaling();
+  ASSERT_TRUE(check.find("OK") == 0 || check.find("WARNING") == 0);
+}
+
+TEST(ArchInfo, CPUFrequencyCheck) {
+  cexa::cpu_frequency performance{0, 3000., 1000., 3500., 3500., "performance",
+                                  "performance"};
+  std::string check = cexa::impl::check_cpu_frequencies(
+      {performance, performance}, "enabled");
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  check = cexa::impl::check_cpu_frequencies({performance}, "disabled");
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+
+  cexa::cpu_frequency powersave = performance;
+
+  powersave.governor                      = "powersave";
+  powersave.energy_performance_preference = "balance_power";
+
+  check = cexa::impl::check_cpu_frequencies({performance, powersave}, "N/A");
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+  ASSERT_NE(check.find("powersave"), std::string::npos) << check;
+
+  cexa::cpu_frequency capped = performance;
+  capped.max                 = 2000.;
+
+  check = cexa::impl::check_cpu_frequencies({capped}, "enabled");
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+
+  // Missing fields are left out of the diagnostic
+  cexa::cpu_frequency unknown = performance;
+
+  unknown.governor                      = "";
+  unknown.energy_performance_preference = "balance_power";
+
+  check = cexa::impl::check_cpu_frequencies({unknown}, "enabled");
+  ASSERT_NE(check.find("governor balance_power on"), std::string::npos)
+      << check;
+
+  unknown.energy_performance_preference = "";
+
+  check = cexa::impl::check_cpu_frequencies({unknown}, "enabled");
+  ASSERT_EQ(check.find("OK"), 0) << check;
+}
+
+TEST(ArchInfo, CPUCores) {
+  std::size_t n_cpus = 0;
+  for (const cexa::cpu_core& core : cexa::get_cpu_cores()) {
+    ASSERT_GT(core.cpus.size(), 0);
+    n_cpus += core.cpus.size();
+  }
+
+  std::vector<std::size_t> cpus =
+      cexa::get_cpu_placement(cexa::cpu_placement::compact);
+  ASSERT_EQ(cpus.size(), n_cpus);
+  ASSERT_LE(cexa::get_cpu_placement(cexa::cpu_placement::one_per_core).size(),
+            n_cpus);
+}
+
+#if defined(__linux__)
+TEST(ArchInfo, CPUCoresSysfs) {
+  namespace fs = std::filesystem;
+
+  // 2 sockets of 16 cores with 2 SMT siblings: cpu i and i + 32 share core i
+  fs::path root = fs::temp_directory_path() / "cexa_cpu_cores_test";
+  fs::remove_all(root);
+  cexa::test::make_fake_sysfs(root, 64);
+
+  std::vector<cexa::cpu_core> cores =
+      cexa::impl::read_cpu_cores((root / "cpu").string());
+  ASSERT_EQ(cores.size(), 32);
+  ASSERT_EQ(cores[0].socket, 0);
+  ASSERT_EQ(cores[0].cpus, (std::vector<std::size_t>{0, 32}));
+  ASSERT_EQ(cores[31].socket, 1);
+  ASSERT_EQ(cores[31].cpus, (std::vector<std::size_t>{31, 63}));
+
+  fs::remove_all(root);
+}
+#endif
+
+TEST(ArchInfo, CPUPlacement) {
+  using cexa::cpu_placement;
+
+  // 2 sockets of 2 cores with 2 SMT siblings, one L3 per socket
+  std::vector<cexa::cpu_core> cores = {
+      {0, 0, {0, 4}}, {0, 1, {1, 5}}, {1, 0, {2, 6}}, {1, 1, {3, 7}}};
+  std::vector<std::vector<std::size_t>> llc_domains = {{0, 1, 4, 5},
+                                                       {2, 3, 6, 7}};
+  auto placement = [&](cpu_placement kind, std::size_t n_threads = 0) {
+    return cexa::impl::make_cpu_placement(cores, llc_domains, kind, n_threads);
+  };
+
+  ASSERT_EQ(placement(cpu_placement::one_per_core),
+            (std::vector<std::size_t>{0, 1, 2, 3}));
+  ASSERT_EQ(placement(cpu_placement::compact),
+            (std::vector<std::size_t>{0, 4, 1, 5, 2, 6, 3, 7}));
+  ASSERT_EQ(placement(cpu_placement::scatter),
+            (std::vector<std::size_t>{0, 2, 1, 3, 4, 6, 5, 7}));
+  ASSERT_EQ(placement(cpu_placement::one_per_llc),
+            (std::vector<std::size_t>{0, 2}));
+  ASSERT_EQ(placement(cpu_placement::scatter, 2),
+            (std::vector<std::size_t>{0, 2}));
+
+  ASSERT_EQ(cexa::format_omp_places({0, 2, 4}), "{0},{2},{4}");
+}
+
+TEST(ArchInfo, LLCDomains) {
+  std::size_t n_cpus = 0;
+  for (const std::vector<std::size_t>& domain : cexa::get_llc_domains()) {
+    ASSERT_GT(domain.size(), 0);
+    n_cpus += domain.size();
+  }
+  std::vector<std::size_t> all_cpus =
+      cexa::get_cpu_placement(cexa::cpu_placement::compact);
+  ASSERT_LE(n_cpus, all_cpus.size());
+
+  cexa::team_policy_hint hint = cexa::suggest_team_policy(1000);
+  ASSERT_GE(hint.team_size, 1);
+  ASSERT_GE(hint.team_size * hint.league_size, 1);
+  ASSERT_GE(hint.chunk_size * hint.league_size, 1000);
+}
+
+#if defined(__linux__)
+TEST(ArchInfo, LLCDomainsSysfs) {
+  namespace fs = std::filesystem;
+
+  // Private L1 and L2 caches and one L3 per 16 cores
+  fs::path root = fs::temp_directory_path() / "cexa_llc_domains_test";
+  fs::remove_all(root);
+  cexa::test::make_fake_sysfs(root, 64);
+
+  std::vector<std::vector<std::size_t>> domains =
+      cexa::impl::read_llc_domains((root / "cpu").string());
+  ASSERT_EQ(domains.size(), 2);
+  for (std::size_t i = 0; i < domains.size(); i++) {
+    ASSERT_EQ(domains[i].size(), 32);
+    ASSERT_EQ(domains[i].front(), 16 * i);
+    ASSERT_EQ(domains[i].back(), 32 + 16 * i + 15);
+  }
+
+  fs::remove_all(root);
+}
+#endif
+
+TEST(ArchInfo, ArmMIDR) {
+  // Neoverse-V2 (NVIDIA Grace) r0p0 and A64FX r1p0
+  cexa::arm_cpu_info grace = cexa::impl::decode_midr(0x410fd4f0);
+  ASSERT_EQ(grace.implementer, 0x41);
+  ASSERT_EQ(grace.part, 0xd4f);
+  ASSERT_EQ(grace.vendor, "ARM");
+  ASSERT_EQ(grace.part_name, "Neoverse-V2");
+
+  cexa::arm_cpu_info a64fx = cexa::impl::decode_midr(0x461f0010);
+  ASSERT_EQ(a64fx.vendor, "Fujitsu");
+  ASSERT_EQ(a64fx.part_name, "A64FX");
+  ASSERT_EQ(a64fx.variant, 1);
+  ASSERT_EQ(a64fx.revision, 0);
+
+  ASSERT_EQ(cexa::impl::decode_midr(0x410fffff).part_name, "Unknown");
+  ASSERT_EQ(cexa::impl::decode_midr(0xff0fd4f0).vendor, "Unknown");
+
+  // /proc/cpuinfo fields of a Neoverse-N1 r3p1
+  ASSERT_EQ(cexa::impl::make_midr("0x41", "0x3", "0xd0c", "1"), 0x413fd0c1);
+  ASSERT_FALSE(cexa::impl::make_midr("", "", "", "").has_value());
+  ASSERT_FALSE(cexa::impl::make_midr("0x41", "0x3", "part", "1").has_value());
+  ASSERT_FALSE(cexa::impl::make_midr("0x141", "0x3", "0xd0c", "1").has_value());
+
+  std::optional<cexa::arm_cpu_info> info = cexa::get_arm_cpu_info();
+  if (info.has_value()) {
+    ASSERT_GT(info->vendor.size(), 0);
+    ASSERT_TRUE(info->sve || info->sve_vector_length == 0);
+  }
+}
+
+#if defined(__linux__)
+TEST(ArchInfo, ArmSysfs) {
+  namespace fs = std::filesystem;
+
+  // 2 sockets of 4 CPUs with 2 clusters of 2 CPUs each, cluster ids restart
+  // at 0 on each socket. cpu7 has no cluster
+  fs::path cpu_dir = fs::temp_directory_path() / "cexa_arm_sysfs_test";
+  fs::remove_all(cpu_dir);
+  for (int cpu = 0; cpu < 8; cpu++) {
+    fs::path topology = cpu_dir / ("cpu" + std::to_string(cpu)) / "topology";
+    fs::create_directories(topology);
+    std::ofstream(topology / "physical_package_id") << cpu / 4 << '\n';
+    std::ofstream(topology / "cluster_id")
+        << (cpu == 7 ? -1 : cpu % 4 / 2) << '\n';
+  }
+  fs::path identification = cpu_dir / "cpu0" / "regs" / "identification";
+  fs::create_directories(identification);
+  std::ofstream(identification / "midr_el1") << "0x00000000410fd4f0\n";
+
+  ASSERT_EQ(cexa::impl::read_midr(cpu_dir.string()), 0x410fd4f0);
+  std::vector<std::vector<std::size_t>> clusters =
+      cexa::impl::read_cpu_clusters(cpu_dir.string());
+  ASSERT_EQ(clusters, (std::vector<std::vector<std::size_t>>{
+                          {0, 1}, {2, 3}, {4, 5}, {6}}));
+
+  std::ofstream(identification / "midr_el1") << "garbage\n";
+  ASSERT_FALSE(cexa::impl::read_midr(cpu_dir.string()).has_value());
+
+  fs::remove_all(cpu_dir);
+  ASSERT_FALSE(cexa::impl::read_midr(cpu_dir.string()).has_value());
+  ASSERT_TRUE(cexa::impl::read_cpu_clusters(cpu_dir.string()).empty());
+}
+#endif
+
+TEST(ArchInfo, TeamPolicyHint) {
+  std::vector<std::vector<std::size_t>> domains = {{0, 1, 2, 3},
+                                                   {4, 5, 6, 7}};
+
+  // 4 threads on each domain: teams of 4
+  std::vector<cexa::thread_binding> bindings = {
+      {0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7}};
+  cexa::team_policy_hint hint =
+      cexa::impl::suggest_team_policy(bindings, domains, 100);
+  ASSERT_EQ(hint.team_size, 4);
+  ASSERT_EQ(hint.league_size, 2);
+  ASSERT_EQ(hint.chunk_size, 50);
+
+  // 2 threads on the first domain, 6 on the second: teams of 2
+  bindings = {{0, 0}, {1, 1}, {2, 4}, {3, 5}, {4, 6}, {5, 7}, {6, 4}, {7, 5}};
+  hint = cexa::impl::suggest_team_policy(bindings, domains, 100);
+  ASSERT_EQ(hint.team_size, 2);
+  ASSERT_EQ(hint.league_size, 4);
+
+  // Migrating threads can not be grouped
+  bindings[1].migrated = true;
+  hint = cexa::impl::suggest_team_policy(bindings, domains, 100);
+  ASSERT_EQ(hint.team_size, 1);
+  ASSERT_EQ(hint.league_size, 8);
+}
+
+// Memory
+TEST(ArchInfo, MemoryInfo) {
+  cexa::memory_info info = cexa::get_memory_info();
+  ASSERT_LE(info.populated_slots, info.devices.size());
+  ASSERT_GE(info.theoretical_bandwidth, 0.);
+
+  std::string check = cexa::check_memory_bandwidth(100.);
+  ASSERT_TRUE(check.find("OK") == 0 || check.find("WARNING") == 0 ||
+              check.find("N/A") == 0)
+      << check;
+}
+
+TEST(ArchInfo, MemorySMBIOS) {
+  // Type 17 structure (SMBIOS 3.3 layout) of a 16 GiB DDR5 DIMM configured at
+  // 4800 MT/s, located in "DIMM_A1"
+  auto memory_device = [](std::size_t size_mib, unsigned char speed_low,
+                          unsigned char speed_high) {
+    std::vector<unsigned char> structure(0x5C, 0);
+    structure[0x00] = 17;
+    structure[0x01] = 0x5C;
+    structure[0x0A] = 64;  // data width
+    structure[0x0C] = size_mib & 0xFF;
+    structure[0x0D] = (size_mib >> 8) & 0xFF;
+    structure[0x10] = 1;     // locator string
+    structure[0x12] = 0x22;  // DDR5
+    structure[0x15] = speed_low;
+    structure[0x16] = speed_high;
+    structure[0x20] = speed_low;
+    structure[0x21] = speed_high;
+    for (char c : std::string("DIMM_A1")) {
+      structure.push_back(c);
+    }
+    structure.insert(structure.end(), {0, 0});
+    return structure;
+  };
+
+  // 4800 = 0x12C0, an empty slot, and the end of table
+  std::vector<unsigned char> table = memory_device(16384, 0xC0, 0x12);
+  std::vector<unsigned char> empty = memory_device(0, 0, 0);
+  table.insert(table.end(), empty.begin(), empty.end());
+  table.insert(table.end(), {127, 4, 0, 0, 0, 0});
+
+  std::vector<cexa::memory_device> devices =
+      cexa::impl::parse_smbios_memory_devices(table);
+  ASSERT_EQ(devices.size(), 2);
+  ASSERT_EQ(devices[0].locator, "DIMM_A1");
+  ASSERT_EQ(devices[0].type, "DDR5");
+  ASSERT_EQ(devices[0].size, std::size_t(16) << 30);
+  ASSERT_EQ(devices[0].speed, 4800);
+  ASSERT_EQ(devices[0].data_width, 64);
+  ASSERT_EQ(devices[1].size, 0);
+
+  // 4800 MT/s * 8 bytes
+  ASSERT_DOUBLE_EQ(cexa::impl::get_theoretical_bandwidth(devices), 38.4);
+
+  cexa::memory_info info{devices, 1, 38.4, "SMBIOS"};
+  std::string check = cexa::impl::check_memory_bandwidth(info, 30.);
+  ASSERT_EQ(check.find("WARNING: 1 empty memory slot(s)"), 0) << check;
+
+  info.devices.pop_back();
+  check = cexa::impl::check_memory_bandwidth(info, 30.);
+  ASSERT_EQ(check.find("OK"), 0) << check;
+  check = cexa::impl::check_memory_bandwidth(info, 10.);
+  ASSERT_EQ(check.find("WARNING: low bandwidth"), 0) << check;
+}
+
+// Timers
+TEST(ArchInfo, TimerInfo) {
+  cexa::timer_info info = cexa::get_timer_info();
+  ASSERT_GT(info.clocksource.size(), 0);
+  ASSERT_GT(info.invariant_tsc.size(), 0);
+  ASSERT_GT(info.overhead, 0.);
+  ASSERT_GT(info.granularity, 0.);
+  ASSERT_GE(info.min_duration, info.granularity);
+
+  ASSERT_EQ(cexa::impl::get_min_timer_duration(20., 1.), 2100.);
+  ASSERT_EQ(cexa::get_timer_repetitions(1.), 1);
+  ASSERT_GE(cexa::get_timer_repetitions(1e-12), 1000);
+}
+
+// NUMA
+TEST(ArchInfo, CPUList) {
+  std::vector<std::size_t> cpus = cexa::impl::parse_cpu_list("0-3,8,10-11\n");
+  ASSERT_EQ(cpus, (std::vector<std::size_t>{0, 1, 2, 3, 8, 10, 11}));
+  ASSERT_EQ(cexa::impl::format_cpu_list(cpus), "0-3,8,10-11");
+
+  // Malformed ranges are skipped
+  ASSERT_EQ(cexa::impl::parse_cpu_list("0,3-,5-4,6-x,7"),
+            (std::vector<std::size_t>{0, 7}));
+}
+
+TEST(ArchInfo, NumaNodes) {
+  for (const cexa::numa_node& node : cexa::get_numa_nodes()) {
+    ASSERT_GT(node.cpus.size(), 0);
+  }
+}
+
+TEST(ArchInfo, ThreadBinding) {
+  std::vector<cexa::thread_binding> bindings =
+      cexa::get_kokkos_thread_binding();
+  const std::size_t concurrency =
+      Kokkos::DefaultHostExecutionSpace().concurrency();
+  ASSERT_EQ(bindings.size(), concurrency);
+
+  std::string check = cexa::check_kokkos_thread_binding();
+  ASSERT_TRUE(check.find("OK") == 0 || check.find("WARNING") == 0);
+}
+
+TEST(ArchInfo, ThreadBindingCheck) {
+  std::vector<cexa::numa_node> nodes = {{0, {0, 1}, {10, 21}},
+                                        {1, {2, 3}, {21, 10}}};
+
+  std::string check =
+      cexa::impl::check_thread_binding({{0, 0, 0}, {1, 2, 1}}, nodes);
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  check = cexa::impl::check_thread_binding({{0, 0, 0}, {1, 0, 0}}, nodes);
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+
+  check = cexa::impl::check_thread_binding({{0, 0, 0, true}, {1, 2, 1}}, nodes);
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+}
+
+TEST(ArchInfo, FirstTouch) {
+  // first_touch_fill requires a View accessible from the host
+  auto view = cexa::first_touch_allocate<
+      Kokkos::View<double*, Kokkos::HostSpace>>("view", 1 << 20);
+  cexa::first_touch_fill(view, 3.);
+  ASSERT_EQ(view(0), 3.);
+  ASSERT_EQ(view(view.size() - 1), 3.);
+
+  // Where the pages land depends on the binding and memory policy of the
+  // process, only the shape of the answer is checked
+  std::vector<int> nodes = cexa::get_page_numa_nodes(
+      view.data(), view.size() * sizeof(double));
+#if defined(__linux__)
+  const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(view.data());
+  const std::uintptr_t end   = begin + view.size() * sizeof(double);
+  ASSERT_EQ(nodes.size(), (end - 1) / page_size - begin / page_size + 1);
+
+  std::vector<cexa::numa_node> numa_nodes = cexa::get_numa_nodes();
+  for (int node : nodes) {
+    ASSERT_TRUE(node == -1 || numa_nodes.empty() ||
+                std::any_of(numa_nodes.begin(), numa_nodes.end(),
+                            [&](const cexa::numa_node& numa_node) {
+                              return static_cast<int>(numa_node.id) == node;
+                            }))
+        << node;
+  }
+#endif
+
+  std::string check = cexa::check_first_touch(view);
+  ASSERT_TRUE(check.find("OK") == 0 || check.find("WARNING") == 0 ||
+              check.find("N/A") == 0)
+      << check;
+}
+
+TEST(ArchInfo, FirstTouchCheck) {
+  // Threads 0 and 1 on node 0, threads 2 and 3 on node 1
+  std::vector<int> threads = {0, 0, 1, 1};
+
+  std::string check =
+      cexa::impl::check_page_placement({0, 0, 0, 0, 1, 1, 1, 1}, threads);
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  check = cexa::impl::check_page_placement({0, 0, 0, 0, 0, 0, 0, 0}, threads);
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+
+  check = cexa::impl::check_page_placement({-1, -1}, threads);
+  ASSERT_EQ(check.find("N/A"), 0) << check;
+}
+
+// Pages
+TEST(ArchInfo, PageInfo) {
+  cexa::page_info info = cexa::get_page_info();
+  ASSERT_GT(info.page_size, 0);
+  for (const std::string& result : {info.map_hugetlb, info.madv_hugepage}) {
+    ASSERT_TRUE(result.rfind("OK", 0) == 0 || result.rfind("WARNING", 0) == 0 ||
+                result.rfind("N/A", 0) == 0);
+  }
+  ASSERT_GT(cexa::recommend_huge_pages(std::size_t(1) << 30).reason.size(), 0);
+
+  std::vector<double> data(1 << 20);
+  cexa::advise_huge_pages(data.data(), data.size() * sizeof(double));
+}
+
+TEST(ArchInfo, TLBCPUID) {
+  using cexa::impl::cpuid_regs;
+  constexpr std::size_t kib = 1024;
+  constexpr std::size_t mib = 1024 * kib;
+
+  // Leaf 0x18: an instruction TLB (skipped), 4 KiB load and store TLBs of 4
+  // ways x 16 sets, and a 12 ways x 128 sets second level TLB
+  std::vector<cexa::tlb_info> tlbs = cexa::impl::decode_cpuid_tlb_leaf(
+      {{3, 8 << 16 | 0x1, 16, 1 << 5 | 2},
+       {0, 4 << 16 | 0x1, 16, 1 << 5 | 4},
+       {0, 4 << 16 | 0x1, 16, 1 << 5 | 5},
+       {0, 12 << 16 | 0x3, 128, 2 << 5 | 3}});
+  ASSERT_EQ(tlbs.size(), 3);
+  ASSERT_EQ(tlbs[0].type, "Load");
+  ASSERT_EQ(tlbs[0].entries, 64);
+  ASSERT_EQ(tlbs[2].level, 2);
+  ASSERT_EQ(tlbs[2].type, "Unified");
+  ASSERT_EQ(tlbs[2].entries, 1536);
+  ASSERT_EQ(tlbs[2].page_sizes, (std::vector<std::size_t>{4 * kib, 2 * mib}));
+
+  // Leaf 0x2: descriptors 0xb4 (DTLB1 4 KiB, 256 entries), 0xb0 (an
+  // instruction TLB) and 0xca (STLB 4 KiB, 512 entries), ebx is invalid
+  tlbs = cexa::impl::decode_cpuid_tlb_descriptors(
+      {0x00b0b401, 0x80000000, 0, 0x00ca0000});
+  ASSERT_EQ(tlbs.size(), 2);
+  ASSERT_EQ(tlbs[0].entries, 256);
+  ASSERT_EQ(tlbs[1].level, 2);
+  ASSERT_EQ(tlbs[1].entries, 512);
+
+  // AMD: 64 entries L1 and 2048 entries L2 data TLBs
+  tlbs = cexa::impl::decode_cpuid_amd_tlbs({0x00400000, 0x00400000, 0, 0},
+                                           {0x08000000, 0x08000000, 0, 0});
+  ASSERT_EQ(tlbs.size(), 4);
+  ASSERT_EQ(tlbs[0].entries, 64);
+  ASSERT_EQ(tlbs[0].page_sizes, (std::vector<std::size_t>{4 * kib}));
+  ASSERT_EQ(tlbs[3].level, 2);
+  ASSERT_EQ(tlbs[3].entries, 2048);
+}
+
+TEST(ArchInfo, HugePageAdvice) {
+  constexpr std::size_t kib = 1024;
+  constexpr std::size_t mib = 1024 * kib;
+
+  // 6 MiB TLB reach, 8 free 2 MiB pages
+  cexa::page_info info;
+  info.page_size              = 4 * kib;
+  info.default_huge_page_size = 2 * mib;
+  info.huge_page_pools        = {{2 * mib, 16, 8}};
+  info.tlbs                   = {{2, "Unified", {4 * kib, 2 * mib}, 1536}};
+  info.map_hugetlb            = "OK";
+  info.madv_hugepage          = "OK";
+  ASSERT_EQ(cexa::impl::get_tlb_reach(info), 6 * mib);
+
+  using cexa::huge_page_mode;
+  auto advice = [&](std::size_t size) {
+    return cexa::impl::recommend_huge_pages(info, size).mode;
+  };
+  ASSERT_EQ(advice(1 * mib), huge_page_mode::none);
+  ASSERT_EQ(advice(64 * mib), huge_page_mode::madvise);
+
+  // Without transparent huge pages, only allocations fitting in the pool
+  info.madv_hugepage = "WARNING";
+  ASSERT_EQ(advice(8 * mib), huge_page_mode::hugetlb);
+  ASSERT_EQ(advice(64 * mib), huge_page_mode::none);
+
+  // Unknown TLBs
+  info.tlbs.clear();
+  ASSERT_EQ(cexa::impl::get_tlb_reach(info), 0);
+  ASSERT_EQ(advice(1 * mib), huge_page_mode::none);
+}
+
+#if defined(__linux__)
+TEST(ArchInfo, HugePageFiles) {
+  namespace fs = std::filesystem;
+
+  fs::path dir = fs::temp_directory_path() / "cexa_huge_pages_test";
+  fs::remove_all(dir);
+  for (auto [name, n_pages, n_free] :
+       {std::tuple{"hugepages-2048kB", 16, 8},
+        std::tuple{"hugepages-1048576kB", 2, 0}}) {
+    fs::path pool = dir / "hugepages" / name;
+    fs::create_directories(pool);
+    std::ofstream(pool / "nr_hugepages") << n_pages << '\n';
+    std::ofstream(pool / "free_hugepages") << n_free << '\n';
+  }
+  std::ofstream(dir / "meminfo") << "MemTotal:       263856532 kB\n"
+                                 << "HugePages_Total:      16\n"
+                                 << "Hugepagesize:       2048 kB\n";
+  std::ofstream(dir / "smaps")
+      << "7f0000000000-7f0000400000 rw-p 00000000 00:00 0\n"
+      << "Size:               4096 kB\n"
+      << "AnonHugePages:         0 kB\n"
+      << "7f0000400000-7f0000800000 rw-p 00000000 00:00 0\n"
+      << "Size:               4096 kB\n"
+      << "AnonHugePages:      2048 kB\n";
+
+  std::vector<cexa::huge_page_pool> pools =
+      cexa::impl::read_huge_page_pools((dir / "hugepages").string());
+  ASSERT_EQ(pools.size(), 2);
+  ASSERT_EQ(pools[0].page_size, 2048 * 1024);
+  ASSERT_EQ(pools[0].n_pages, 16);
+  ASSERT_EQ(pools[0].n_free, 8);
+  ASSERT_EQ(pools[1].page_size, std::size_t(1) << 30);
+
+  const std::string meminfo = (dir / "meminfo").string();
+  ASSERT_EQ(cexa::impl::read_default_huge_page_size(meminfo), 2048 * 1024);
+
+  std::ofstream(dir / "hpage_pmd_size") << "2097152\n";
+  const std::string pmd_size = (dir / "hpage_pmd_size").string();
+  ASSERT_EQ(cexa::impl::read_transparent_huge_page_size(pmd_size),
+            2048 * 1024);
+  ASSERT_EQ(cexa::impl::read_transparent_huge_page_size(pmd_size + "_missing"),
+            0);
+
+  const std::string smaps = (dir / "smaps").string();
+  auto* address = reinterpret_cast<const void*>(0x7f0000500000);
+  ASSERT_EQ(cexa::impl::read_anon_huge_pages(smaps, address), 2048 * 1024);
+  address = reinterpret_cast<const void*>(0x7f0000100000);
+  ASSERT_EQ(cexa::impl::read_anon_huge_pages(smaps, address), 0);
+
+  fs::remove_all(dir);
+}
+#endif
+
 // GPU
 TEST(ArchInfo, GPUName) { ASSERT_GT(cexa::get_gpu_name().size(), 0); }
 
@@ -43,7 +737,646 @@ TEST(ArchInfo, GPURuntimeVersion) {
   ASSERT_GT(cexa::get_gpu_runtime_version().size(), 0);
 }
 
+// Kokkos
+TEST(ArchInfo, KokkosConfig) {
+  cexa::kokkos_config config = cexa::get_kokkos_config();
+  ASSERT_GT(config.version.size(), 0);
+  ASSERT_GT(config.backends.size(), 0);
+  ASSERT_GT(config.simd_abi.size(), 0);
+  ASSERT_GT(config.simd_width, 0);
+  ASSERT_GT(config.host_concurrency, 0);
+  ASSERT_GT(config.configuration.size(), 0);
+
+  std::string check = cexa::check_kokkos_arch();
+  ASSERT_TRUE(check.find("OK") == 0 || check.find("WARNING") == 0) << check;
+}
+
+TEST(ArchInfo, KokkosArchCheck) {
+  using cexa::impl::check_kokkos_arch;
+
+  std::string check =
+      check_kokkos_arch({"AVX2", "HSW"}, {"sse2", "avx", "avx2", "fma"});
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  // Compiled for an instruction set the CPU lacks
+  check = check_kokkos_arch({"AVX512XEON", "SKX"}, {"avx", "avx2"});
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+  ASSERT_NE(check.find("avx512f"), std::string::npos) << check;
+
+  // The widest vector extension of the CPU is left unused
+  check = check_kokkos_arch({"AVX2", "HSW"}, {"avx", "avx2", "avx512f"});
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+  check = check_kokkos_arch({}, {"asimd", "sve"});
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+  check = check_kokkos_arch({"NATIVE"}, {"avx", "avx2", "avx512f"});
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  check = check_kokkos_arch({"ARMV9_GRACE", "ARM_SVE"}, {"asimd", "sve"});
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+  ASSERT_NE(check.find("sve2"), std::string::npos) << check;
+
+  check = check_kokkos_arch({"AVX2"}, {});
+  ASSERT_EQ(check.find("OK"), 0) << check;
+}
+
+// Report
+TEST(ArchInfo, ReportJson) {
+  cexa::arch_report report = cexa::get_arch_report();
+  ASSERT_EQ(report.cpu.model, cexa::get_cpu_model_name());
+  ASSERT_EQ(report.os.kernel, cexa::get_kernel_version());
+
+  std::stringstream json;
+  cexa::write_json(report, json);
+  ASSERT_EQ(json.str().front(), '{');
+  ASSERT_NE(json.str().find("\"kernel\": \"" + report.os.kernel + "\""),
+            std::string::npos);
+}
+
+TEST(ArchInfo, ReportFull) {
+  // The thread binding is only checked by the full report
+  std::stringstream json;
+  cexa::write_json(cexa::get_arch_report(), json);
+  ASSERT_NE(json.str().find("\"thread_binding\": null"), std::string::npos);
+
+  cexa::arch_report report = cexa::get_arch_report(true);
+  ASSERT_EQ(report.cpu.model, cexa::get_cpu_model_name());
+  ASSERT_GT(report.kokkos.thread_binding.size(), 0);
+}
+
+TEST(ArchInfo, ReportYaml) {
+  std::stringstream yaml;
+  cexa::write_yaml(cexa::get_arch_report(), yaml);
+  ASSERT_EQ(yaml.str().find("os:\n"), 0);
+  ASSERT_NE(yaml.str().find("\nkokkos:\n"), std::string::npos);
+}
+
+// Roofline
+TEST(ArchInfo, Roofline) {
+  // Small sizes keep the test fast, the full measurement takes a few seconds
+  // and allocates the DRAM working set
+  Kokkos::DefaultHostExecutionSpace space;
+  cexa::impl::roofline_sizes sizes =
+      cexa::impl::get_roofline_sizes(space.concurrency());
+  sizes.l2             = std::min(sizes.l2, sizes.l1 * 4);
+  sizes.l3             = std::min(sizes.l3, sizes.l1 * 16);
+  sizes.dram           = std::min(sizes.dram, std::size_t(16) << 20);
+  sizes.bytes_per_item = std::size_t(1) << 20;
+  sizes.fma_iterations = 1 << 8;
+
+  cexa::roofline result = cexa::impl::measure_roofline(space, sizes);
+  ASSERT_GT(result.fp64_gflops, 0.);
+  ASSERT_GT(result.fp32_gflops, 0.);
+  ASSERT_GT(result.l1_bandwidth, 0.);
+  ASSERT_GT(result.dram_bandwidth, 0.);
+}
+
+TEST(ArchInfo, RooflineCache) {
+  std::string cache_file =
+      (std::filesystem::temp_directory_path() / "cexa_roofline_test").string();
+  std::remove(cache_file.c_str());
+
+  cexa::roofline result{"Serial", 1., 2., 3., 4., 5., 6.};
+  cexa::impl::save_roofline(cache_file, "other", {"Serial", 7.});
+  cexa::impl::save_roofline(cache_file, "key", result);
+  cexa::impl::save_roofline(cache_file, "key", result);
+
+  std::optional<cexa::roofline> cached =
+      cexa::impl::load_roofline(cache_file, "key");
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_EQ(cached->fp32_gflops, 2.);
+  ASSERT_EQ(cached->dram_bandwidth, 6.);
+  ASSERT_EQ(cexa::impl::load_roofline(cache_file, "other")->fp64_gflops, 7.);
+  ASSERT_FALSE(cexa::impl::load_roofline(cache_file, "missing").has_value());
+
+  // The ceilings measured with 4 threads are not reused with 64 threads
+  std::string key_4  = cexa::impl::get_roofline_cache_key("Serial", 4);
+  std::string key_64 = cexa::impl::get_roofline_cache_key("Serial", 64);
+  cexa::impl::save_roofline(cache_file, key_4, result);
+  ASSERT_TRUE(cexa::impl::load_roofline(cache_file, key_4).has_value());
+  ASSERT_FALSE(cexa::impl::load_roofline(cache_file, key_64).has_value());
+
+  std::remove(cache_file.c_str());
+}
+
+// Autotuning
+TEST(ArchInfo, Autotune) {
+  std::string cache_file =
+      (std::filesystem::temp_directory_path() / "cexa_autotune_test").string();
+  std::remove(cache_file.c_str());
+
+  // The kernels run on the default host execution space
+  using exec_space = Kokkos::DefaultHostExecutionSpace;
+  Kokkos::View<double*, Kokkos::HostSpace> a("a", 1 << 16);
+  cexa::autotune_result result = cexa::autotune_range_policy(
+      "cexa::test_autotune_range", a.size(),
+      KOKKOS_LAMBDA(std::size_t i) { a(i) = 2. * a(i) + 1.; }, cache_file);
+  ASSERT_FALSE(result.from_cache);
+  ASSERT_GT(result.time, 0.);
+
+  cexa::autotune_result cached = cexa::autotune_range_policy(
+      "cexa::test_autotune_range", a.size(),
+      KOKKOS_LAMBDA(std::size_t i) { a(i) = 2. * a(i) + 1.; }, cache_file);
+  ASSERT_TRUE(cached.from_cache);
+  ASSERT_EQ(cached.chunk_size, result.chunk_size);
+
+  using member_type = Kokkos::TeamPolicy<exec_space>::member_type;
+  result = cexa::autotune_team_policy(
+      "cexa::test_autotune_team", 64,
+      KOKKOS_LAMBDA(const member_type& team) {
+        a(team.league_rank()) += 1.;
+      },
+      cache_file);
+  ASSERT_GE(result.team_size, 1);
+  ASSERT_GE(result.vector_length, 1);
+  std::string key = cexa::impl::get_autotune_cache_key(
+      "cexa::test_autotune_team", exec_space::name(),
+      exec_space().concurrency());
+  ASSERT_TRUE(cexa::impl::load_autotune(cache_file, key).has_value());
+  // Another thread count does not reuse the tuned parameters
+  key = cexa::impl::get_autotune_cache_key("cexa::test_autotune_team",
+                                           exec_space::name(),
+                                           exec_space().concurrency() + 1);
+  ASSERT_FALSE(cexa::impl::load_autotune(cache_file, key).has_value());
+
+  // Labels with tabs or newlines do not break the other entries of the file
+  ASSERT_EQ(cexa::impl::escape_cache_key("a\tb\nc\\d"), "a\\tb\\nc\\\\d");
+  std::string odd_key = cexa::impl::get_autotune_cache_key(
+      "cexa::test\tautotune\n", exec_space::name(),
+      exec_space().concurrency());
+  cexa::impl::save_autotune(cache_file, odd_key, result);
+  cexa::impl::save_autotune(cache_file, odd_key, result);
+  ASSERT_TRUE(cexa::impl::load_autotune(cache_file, odd_key).has_value());
+  key = cexa::impl::get_autotune_cache_key("cexa::test_autotune_team",
+                                           exec_space::name(),
+                                           exec_space().concurrency());
+  ASSERT_TRUE(cexa::impl::load_autotune(cache_file, key).has_value());
+  std::ifstream file(cache_file);
+  std::string line;
+  int n_lines = 0;
+  while (std::getline(file, line)) {
+    n_lines++;
+  }
+  ASSERT_EQ(n_lines, 3);
+
+  std::remove(cache_file.c_str());
+}
+
+TEST(ArchInfo, AutotuneCandidates) {
+  ASSERT_EQ(cexa::impl::get_vector_length_candidates(1),
+            (std::vector<int>{1}));
+  ASSERT_EQ(cexa::impl::get_vector_length_candidates(64),
+            (std::vector<int>{1, 2, 4, 8}));
+  ASSERT_EQ(cexa::impl::get_chunk_size_candidates(1000, 4),
+            (std::vector<std::size_t>{0, 1, 4, 16, 64}));
+
+  std::vector<int> team_sizes = cexa::impl::get_team_size_candidates(16);
+  ASSERT_GE(team_sizes.size(), 5);
+  for (int team_size : team_sizes) {
+    ASSERT_LE(team_size, 16);
+  }
+}
+
+// Kernel counters
+TEST(ArchInfo, KernelCounters) {
+  if (!cexa::start_kernel_counters()) {
+    // No PMU, or perf_event_paranoid forbids it
+    ASSERT_GT(cexa::get_kernel_counters_status().size(), 0);
+    return;
+  }
+
+  Kokkos::parallel_for(
+      "cexa::test_kernel", Kokkos::RangePolicy<>(0, 1 << 20),
+      KOKKOS_LAMBDA(int i) { (void)i; });
+  Kokkos::fence();
+  cexa::stop_kernel_counters();
+
+  std::vector<cexa::kernel_counters> results = cexa::get_kernel_counters();
+  auto result = std::find_if(results.begin(), results.end(), [](auto& c) {
+    return c.label == "cexa::test_kernel";
+  });
+  ASSERT_NE(result, results.end());
+  ASSERT_EQ(result->n_calls, 1);
+  ASSERT_GE(result->ipc(), 0.);
+
+  cexa::reset_kernel_counters();
+  ASSERT_TRUE(cexa::get_kernel_counters().empty());
+}
+
+TEST(ArchInfo, KernelHooks) {
+  namespace KTE = Kokkos::Tools::Experimental;
+
+  // Stands for a Kokkos tool registered before the hooks, it must keep
+  // receiving the kernels with its own ids and get its callbacks back
+  static int n_tool_kernels = 0, n_hook_kernels = 0;
+  KTE::set_begin_parallel_for_callback(
+      [](const char*, const std::uint32_t, std::uint64_t* kernel_id) {
+        *kernel_id = 42;
+      });
+  KTE::set_end_parallel_for_callback([](const std::uint64_t kernel_id) {
+    n_tool_kernels += kernel_id == 42;
+  });
+  const KTE::EventSet tool_callbacks = KTE::get_callbacks();
+
+  auto begin = [](const char*, std::uint64_t) {};
+  auto end   = [](std::uint64_t) { n_hook_kernels++; };
+  cexa::impl::add_kernel_hooks(begin, end);
+  Kokkos::parallel_for(
+      "cexa::test_hooks",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 1), [](int) {});
+  Kokkos::fence();
+  cexa::impl::remove_kernel_hooks(begin, end);
+
+  ASSERT_EQ(n_tool_kernels, 1);
+  ASSERT_EQ(n_hook_kernels, 1);
+  ASSERT_EQ(KTE::get_callbacks().begin_parallel_for,
+            tool_callbacks.begin_parallel_for);
+  ASSERT_EQ(KTE::get_callbacks().end_parallel_for,
+            tool_callbacks.end_parallel_for);
+
+  KTE::set_begin_parallel_for_callback(nullptr);
+  KTE::set_end_parallel_for_callback(nullptr);
+}
+
+// Energy
+TEST(ArchInfo, EnergyDelta) {
+  ASSERT_EQ(cexa::impl::get_energy_delta(100, 250, 1000), 150);
+  // The counter wrapped around
+  ASSERT_EQ(cexa::impl::get_energy_delta(900, 50, 1000), 150);
+}
+
+TEST(ArchInfo, KernelEnergy) {
+  namespace fs = std::filesystem;
+
+  // One package with a DRAM subzone, and its MMIO duplicate
+  fs::path powercap_dir = fs::temp_directory_path() / "cexa_powercap_test";
+  fs::remove_all(powercap_dir);
+  auto add_zone = [&](const char* zone, const char* name) {
+    fs::create_directories(powercap_dir / zone);
+    std::ofstream(powercap_dir / zone / "name") << name << '\n';
+    std::ofstream(powercap_dir / zone / "max_energy_range_uj") << "1000000\n";
+    std::ofstream(powercap_dir / zone / "energy_uj") << "900000\n";
+  };
+  add_zone("intel-rapl:0", "package-0");
+  add_zone("intel-rapl:0:0", "dram");
+  add_zone("intel-rapl:0:1", "core");
+  add_zone("intel-rapl-mmio:0", "package-0");
+
+  std::vector<cexa::impl::rapl_domain> domains =
+      cexa::impl::read_rapl_domains(powercap_dir.string());
+  ASSERT_EQ(domains.size(), 2);
+  ASSERT_EQ(domains[0].name, "package-0");
+  ASSERT_EQ(domains[1].name, "dram");
+  ASSERT_EQ(domains[1].max_energy_range_uj, 1000000);
+
+  ASSERT_TRUE(cexa::start_energy_measurement(powercap_dir.string()));
+  cexa::reset_kernel_energy();
+
+  // The kernel consumes 0.3 J on the package, wrapping its counter, and
+  // 0.1 J on the DRAM
+  fs::path package_file = powercap_dir / "intel-rapl:0" / "energy_uj";
+  fs::path dram_file    = powercap_dir / "intel-rapl:0:0" / "energy_uj";
+  Kokkos::parallel_for(
+      "cexa::test_energy",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 1),
+      [&](int) {
+        std::ofstream(package_file) << "200000\n";
+        std::ofstream(dram_file) << "1000000\n";
+      });
+  Kokkos::fence();
+  cexa::stop_energy_measurement();
+
+  std::vector<cexa::kernel_energy> results = cexa::get_kernel_energy();
+  auto result = std::find_if(results.begin(), results.end(), [](auto& e) {
+    return e.label == "cexa::test_energy";
+  });
+  ASSERT_NE(result, results.end());
+  ASSERT_EQ(result->n_calls, 1);
+  ASSERT_NEAR(result->package_energy, 0.3, 1e-9);
+  ASSERT_NEAR(result->dram_energy, 0.1, 1e-9);
+  ASSERT_NEAR(result->energy(), 0.4, 1e-9);
+  ASSERT_GT(result->average_power(), 0.);
+
+  cexa::reset_kernel_energy();
+  ASSERT_TRUE(cexa::get_kernel_energy().empty());
+
+  fs::remove_all(powercap_dir);
+  ASSERT_FALSE(cexa::start_energy_measurement(powercap_dir.string()));
+  ASSERT_NE(cexa::get_energy_status().find("unavailable"), std::string::npos);
+}
+
+TEST(ArchInfo, KernelEnergyAndCounters) {
+  namespace fs = std::filesystem;
+
+  fs::path powercap_dir = fs::temp_directory_path() / "cexa_powercap_both";
+  fs::remove_all(powercap_dir);
+  fs::create_directories(powercap_dir / "intel-rapl:0");
+  std::ofstream(powercap_dir / "intel-rapl:0" / "name") << "package-0\n";
+  std::ofstream(powercap_dir / "intel-rapl:0" / "energy_uj") << "0\n";
+
+  // Both measurements register their hooks, the one stopped first must not
+  // unregister the other
+  const bool counting = cexa::start_kernel_counters();
+  ASSERT_TRUE(cexa::start_energy_measurement(powercap_dir.string()));
+  cexa::reset_kernel_counters();
+  cexa::reset_kernel_energy();
+
+  auto run_kernel = []() {
+    Kokkos::parallel_for(
+        "cexa::test_energy_and_counters",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, 1),
+        [](int) {});
+    Kokkos::fence();
+  };
+  run_kernel();
+  cexa::stop_kernel_counters();
+  run_kernel();
+  cexa::stop_energy_measurement();
+  run_kernel();
+
+  auto find_label = [](const auto& results) {
+    return std::find_if(results.begin(), results.end(), [](const auto& r) {
+      return r.label == "cexa::test_energy_and_counters";
+    });
+  };
+  std::vector<cexa::kernel_energy> energies = cexa::get_kernel_energy();
+  ASSERT_NE(find_label(energies), energies.end());
+  ASSERT_EQ(find_label(energies)->n_calls, 2);
+  if (counting) {
+    std::vector<cexa::kernel_counters> counters = cexa::get_kernel_counters();
+    ASSERT_NE(find_label(counters), counters.end());
+    ASSERT_EQ(find_label(counters)->n_calls, 1);
+  }
+
+  fs::remove_all(powercap_dir);
+}
+
+// Noise
+TEST(ArchInfo, Noise) {
+  cexa::noise_report report = cexa::measure_noise(0.05);
+  ASSERT_EQ(report.cpus.size(),
+            Kokkos::DefaultHostExecutionSpace().concurrency());
+  for (const cexa::cpu_noise& noise : report.cpus) {
+    ASSERT_GT(noise.n_quanta, 0);
+    ASSERT_GT(noise.quantum, 0.);
+    ASSERT_GE(noise.lost_fraction, 0.);
+    ASSERT_LE(noise.lost_fraction, 1.);
+  }
+  ASSERT_LE(report.noisy_cpus.size(), report.avoid_cpus.size());
+}
+
+TEST(ArchInfo, NoiseProcFiles) {
+  namespace fs = std::filesystem;
+
+  fs::path proc_dir = fs::temp_directory_path() / "cexa_noise_test";
+  fs::remove_all(proc_dir);
+  fs::create_directories(proc_dir);
+
+  // CPU 1 is offline, CPU 2 receives the network interrupts
+  std::ofstream(proc_dir / "interrupts_before")
+      << "           CPU0       CPU2\n"
+      << "  0:         44          0   IO-APIC   2-edge      timer\n"
+      << " 24:         10        100   PCI-MSI 524288-edge   eth0\n"
+      << "LOC:       1000       1000   Local timer interrupts\n"
+      << "ERR:          0\n";
+  std::ofstream(proc_dir / "interrupts_after")
+      << "           CPU0       CPU2\n"
+      << "  0:         44          0   IO-APIC   2-edge      timer\n"
+      << " 24:         10       5100   PCI-MSI 524288-edge   eth0\n"
+      << "LOC:       1100       1100   Local timer interrupts\n"
+      << "ERR:          0\n";
+  std::ofstream(proc_dir / "stat_before")
+      << "cpu  0 0 0 0 0 0 0 0 0 0\n"
+      << "cpu0 100 0 50 800 0 0 0 0 0 0\n"
+      << "cpu2 100 0 50 800 0 10 10 0 0 0\n";
+  std::ofstream(proc_dir / "stat_after")
+      << "cpu  0 0 0 0 0 0 0 0 0 0\n"
+      << "cpu0 200 0 50 800 0 0 0 0 0 0\n"
+      << "cpu2 150 0 50 800 0 30 40 0 0 0\n";
+
+  cexa::impl::interrupt_counts before =
+      cexa::impl::read_interrupts((proc_dir / "interrupts_before").string());
+  ASSERT_EQ(before.cpus, (std::vector<std::size_t>{0, 2}));
+  ASSERT_EQ(before.sources.at("LOC: Local timer interrupts"),
+            (std::vector<std::uint64_t>{1000, 1000}));
+  ASSERT_EQ(before.sources.at("ERR:"), (std::vector<std::uint64_t>{0, 0}));
+
+  std::vector<cexa::cpu_noise> cpus(3);
+  cpus[0].cpu = 0;
+  cpus[1].cpu = 2;
+  cpus[2].cpu = -1;
+  cexa::impl::add_os_activity(
+      cpus, before,
+      cexa::impl::read_interrupts((proc_dir / "interrupts_after").string()),
+      cexa::impl::read_cpu_stats((proc_dir / "stat_before").string()),
+      cexa::impl::read_cpu_stats((proc_dir / "stat_after").string()));
+
+  ASSERT_EQ(cpus[0].interrupts, 100);
+  ASSERT_EQ(cpus[0].top_interrupt, "LOC: Local timer interrupts");
+  ASSERT_EQ(cpus[0].irq_fraction, 0.);
+  ASSERT_EQ(cpus[1].interrupts, 5100);
+  ASSERT_EQ(cpus[1].top_interrupt, "24: PCI-MSI 524288-edge eth0");
+  ASSERT_DOUBLE_EQ(cpus[1].irq_fraction, 0.5);
+  ASSERT_EQ(cpus[2].interrupts, 0);
+
+  fs::remove_all(proc_dir);
+}
+
+TEST(ArchInfo, NoisyCPUs) {
+  std::vector<cexa::cpu_noise> cpus(4);
+  for (int cpu = 0; cpu < 4; cpu++) {
+    cpus[cpu].cpu           = cpu;
+    cpus[cpu].lost_fraction = 1e-4;
+    cpus[cpu].max_delay     = 2e4;
+    cpus[cpu].interrupts    = 250;
+  }
+  ASSERT_TRUE(cexa::impl::find_noisy_cpus(cpus, 1.).empty());
+
+  cpus[1].lost_fraction = 1e-2;
+  cpus[2].max_delay     = 5e6;
+  cpus[3].interrupts    = 20000;
+  ASSERT_EQ(cexa::impl::find_noisy_cpus(cpus, 1.),
+            (std::vector<std::size_t>{1, 2, 3}));
+
+  // The CPUs of migrating threads are ignored
+  cpus[1].cpu = -1;
+  ASSERT_EQ(cexa::impl::find_noisy_cpus(cpus, 1.),
+            (std::vector<std::size_t>{2, 3}));
+}
+
+// Rank placement
+TEST(ArchInfo, RankPlacementCheck) {
+  using cexa::impl::check_rank_placement;
+
+  // 4 ranks of 4 CPUs over 2 NUMA nodes
+  std::vector<cexa::rank_placement> placements = {
+      {0, 100, 4, {0, 1, 2, 3}, {0}},
+      {1, 101, 4, {4, 5, 6, 7}, {0}},
+      {2, 102, 4, {8, 9, 10, 11}, {1}},
+      {3, 103, 4, {12, 13, 14, 15}, {1}}};
+  std::string check = check_rank_placement(placements, 4, 2);
+  ASSERT_EQ(check.find("OK"), 0) << check;
+
+  check = check_rank_placement(placements, 5, 2);
+  ASSERT_EQ(check.find("WARNING"), 0) << check;
+
+  std::vector<cexa::rank_placement> overlap = placements;
+  overlap[1].cpus = {2, 3, 4, 5};
+  check           = check_rank_placement(overlap, 4, 2);
+  ASSERT_NE(check.find("ranks 0 and 1 share CPUs 2-3"), std::string::npos)
+      << check;
+
+  std::vector<cexa::rank_placement> oversubscribed = placements;
+  oversubscribed[3].concurrency = 8;
+  check                         = check_rank_placement(oversubscribed, 4, 2);
+  ASSERT_NE(check.find("more threads"), std::string::npos) << check;
+  ASSERT_NE(check.find("uneven Kokkos concurrency"), std::string::npos)
+      << check;
+
+  std::vector<cexa::rank_placement> packed = placements;
+  packed[2].numa_nodes = {0};
+  packed[3].numa_nodes = {0};
+  check                = check_rank_placement(packed, 4, 2);
+  ASSERT_NE(check.find("uneven ranks per NUMA node"), std::string::npos)
+      << check;
+}
+
+#if defined(__linux__)
+// Ranks 0 and 1 publish CPUs 4-7 and 8-11, ranks 2 and 3 both publish CPUs
+// 0-3 so that they overlap
+constexpr std::size_t n_placement_ranks = 4;
+constexpr const char* placement_run     = "test";
+
+cexa::rank_placement get_test_rank_placement(std::size_t rank) {
+  std::vector<std::size_t> cpus = {0, 1, 2, 3};
+  if (rank < 2) {
+    cpus = {4 * rank + 4, 4 * rank + 5, 4 * rank + 6, 4 * rank + 7};
+  }
+  return cexa::rank_placement{rank, static_cast<long>(getpid()), 4, cpus, {}};
+}
+
+// Ranks 1 to 3 of RankPlacementProcesses, run by a new instance of the test
+// executable before it starts any thread
+int run_test_rank(std::size_t rank, const std::string& file) {
+  cexa::impl::publish_rank_placement(file, placement_run,
+                                     get_test_rank_placement(rank));
+  std::size_t n_seen = cexa::impl::collect_rank_placements(
+                           file, placement_run, n_placement_ranks, 10.)
+                           .size();
+  cexa::impl::release_rank_placements(file, placement_run, rank,
+                                      n_placement_ranks);
+  return n_seen == n_placement_ranks ? 0 : 1;
+}
+
+TEST(ArchInfo, RankPlacementProcesses) {
+  // Unique per process so that concurrent test runs do not share it, and
+  // removed on every exit path, including a timeout of the other ranks
+  std::string file = (std::filesystem::temp_directory_path() /
+                      ("cexa_placement_test_" + std::to_string(getpid())))
+                         .string();
+  std::remove(file.c_str());
+  struct remove_file {
+    std::string file;
+    ~remove_file() { std::remove(file.c_str()); }
+  } cleanup{file};
+
+  // Forking this process would copy the state of the Kokkos threads, the
+  // children run the test executable from the start instead
+  constexpr std::size_t n_ranks = n_placement_ranks;
+  std::vector<pid_t> children;
+  for (std::size_t rank = 1; rank < n_ranks; rank++) {
+    std::string rank_arg = std::to_string(rank);
+    char* argv[]         = {const_cast<char*>("TestArchInfo"),
+                            const_cast<char*>("--cexa-test-rank"),
+                            rank_arg.data(), file.data(), nullptr};
+    pid_t pid;
+    ASSERT_EQ(
+        posix_spawn(&pid, "/proc/self/exe", nullptr, nullptr, argv, environ),
+        0);
+    children.push_back(pid);
+  }
+
+  cexa::impl::publish_rank_placement(file, placement_run,
+                                     get_test_rank_placement(0));
+  std::vector<cexa::rank_placement> placements =
+      cexa::impl::collect_rank_placements(file, placement_run, n_ranks, 10.);
+  cexa::impl::release_rank_placements(file, placement_run, 0, n_ranks);
+
+  for (pid_t child : children) {
+    int status = -1;
+    waitpid(child, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+
+  ASSERT_EQ(placements.size(), n_ranks);
+  for (std::size_t rank = 0; rank < n_ranks; rank++) {
+    ASSERT_EQ(placements[rank].rank, rank);
+    ASSERT_EQ(placements[rank].cpus, get_test_rank_placement(rank).cpus);
+  }
+  std::string check = cexa::impl::check_rank_placement(placements, n_ranks, 1);
+  ASSERT_NE(check.find("ranks 2 and 3 share CPUs 0-3"), std::string::npos)
+      << check;
+  // The last rank to finish removed the file
+  ASSERT_FALSE(std::filesystem::exists(file));
+
+  // A single process exchanging with itself
+  placements = cexa::exchange_rank_placement(0, 1, file);
+  ASSERT_EQ(placements.size(), 1);
+  ASSERT_EQ(placements[0].cpus, cexa::get_process_cpus());
+  check = cexa::check_rank_placement(placements, 1);
+  ASSERT_EQ(check.find("OK"), 0) << check;
+}
+
+TEST(ArchInfo, RankPlacementStaleRun) {
+  std::string file = (std::filesystem::temp_directory_path() /
+                      ("cexa_placement_stale_" + std::to_string(getpid())))
+                         .string();
+  std::remove(file.c_str());
+
+  // Left behind by a crashed run of a launcher with the same pid
+  std::ofstream(file) << "rank crashed 0 1 4 0-3 0\n"
+                      << "rank crashed 1 2 4 4-7 0\n"
+                      << "done crashed 1\n";
+  ASSERT_TRUE(cexa::impl::collect_rank_placements(file, "current", 2, 0.)
+                  .empty());
+
+  cexa::impl::publish_rank_placement(file, "current",
+                                     get_test_rank_placement(0));
+  std::vector<cexa::rank_placement> placements =
+      cexa::impl::collect_rank_placements(file, "current", 2, 0.);
+  ASSERT_EQ(placements.size(), 1);
+  ASSERT_EQ(placements[0].cpus, get_test_rank_placement(0).cpus);
+
+  // The "done" line of the crashed run does not count for this one
+  cexa::impl::release_rank_placements(file, "current", 0, 2);
+  ASSERT_TRUE(std::filesystem::exists(file));
+  cexa::impl::release_rank_placements(file, "current", 1, 2);
+  ASSERT_FALSE(std::filesystem::exists(file));
+
+  ASSERT_FALSE(cexa::impl::get_placement_run_id().empty());
+}
+
+TEST(ArchInfo, LocalRank) {
+  setenv("SLURM_LOCALID", "1", 1);
+  setenv("SLURM_NODEID", "2", 1);
+  setenv("SLURM_STEP_TASKS_PER_NODE", "2(x2),3", 1);
+  std::optional<cexa::impl::local_rank> local = cexa::impl::get_local_rank();
+  unsetenv("SLURM_LOCALID");
+  unsetenv("SLURM_NODEID");
+  unsetenv("SLURM_STEP_TASKS_PER_NODE");
+
+  ASSERT_TRUE(local.has_value());
+  ASSERT_EQ(local->rank, 1);
+  ASSERT_EQ(local->size, 3);
+}
+#endif
+
 int main(int argc, char *argv[]) {
+#if defined(__linux__)
+  if (argc == 4 && std::string(argv[1]) == "--cexa-test-rank") {
+    return run_test_rank(std::stoul(argv[2]), argv[3]);
+  }
+#endif
+
   Kokkos::initialize(argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
   int result = RUN_ALL_TESTS();
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_SIMD_ACCURACY_HPP
+#define CEXA_SIMD_ACCURACY_HPP
+
+#include <Kokkos_SIMD.hpp>
+
+namespace cexa {
+
+// Accuracy tags of the simd math functions, e.g. Kokkos::exp<cexa::fast>(x)
+
+// Maximum error of 1 ULP (0.5 ULP for hypot, 1.5 ULP for erfc)
+struct accurate {};
+// Maximum error of 3.5 ULP for the functions where sleef provides a faster
+// variant (exp2, log, log2, cbrt, sin, cos, tan, asin, acos, atan, sinh, cosh,
+// tanh, hypot and atan2), the accurate variant otherwise
+struct fast {};
+
+// Accuracy of the calls without a tag, set with CEXA_SIMD_SLEEF_FAST
+#if defined(CEXA_SIMD_SLEEF_FAST)
+using default_accuracy = fast;
+#else
+using default_accuracy = accurate;
+#endif
+
+}  // namespace cexa
+
+namespace Kokkos {
+
+// NOTE: The tagged overloads of a backend take precedence over these ones,
+// which ignore the tag and call the overload without a tag. They must be
+// declared after the overloads of the backends without tags (svml).
+
+#define CEXA_IMPL_ACCURACY_UNARY_FUNCTION(func)         \
+  template <class Accuracy, class T, class Abi>         \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION   \
+      Experimental::basic_simd<T, Abi>                  \
+      func(Experimental::basic_simd<T, Abi> const& a) { \
+    return func(a);                                     \
+  }
+
+#define CEXA_IMPL_ACCURACY_BINARY_FUNCTION(func)        \
+  template <class Accuracy, class T, class Abi>         \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION   \
+      Experimental::basic_simd<T, Abi>                  \
+      func(Experimental::basic_simd<T, Abi> const& a,   \
+           Experimental::basic_simd<T, Abi> const& b) { \
+    return func(a, b);                                  \
+  }
+
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(exp)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(exp2)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(log)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(log10)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(log2)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(cbrt)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(sin)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(cos)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(tan)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(asin)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(acos)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(atan)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(sinh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(cosh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(tanh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(asinh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(acosh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(atanh)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(erf)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(erfc)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(tgamma)
+CEXA_IMPL_ACCURACY_UNARY_FUNCTION(lgamma)
+
+CEXA_IMPL_ACCURACY_BINARY_FUNCTION(pow)
+CEXA_IMPL_ACCURACY_BINARY_FUNCTION(hypot)
+CEXA_IMPL_ACCURACY_BINARY_FUNCTION(atan2)
+
+}  // namespace Kokkos
+
+#undef CEXA_IMPL_ACCURACY_UNARY_FUNCTION
+#undef CEXA_IMPL_ACCURACY_BINARY_FUNCTION
+
+#endif
@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_SIMD_DISPATCH_HPP
+#define CEXA_SIMD_DISPATCH_HPP
+
+#include <CEXA_SIMD_Backends.hpp>
+
+#if !defined(__x86_64__) || !defined(__GNUC__) || \
+    !(defined(CEXA_SIMD_ENABLE_SLEEF) || defined(CEXA_SIMD_ENABLE_LIBMVEC))
+#error "The runtime dispatch requires the sleef or libmvec backend on x86_64"
+#endif
+
+#include <immintrin.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(CEXA_SIMD_ENABLE_LIBMVEC)
+// For __GLIBC_PREREQ
+#include <features.h>
+#endif
+
+// Math functions on arrays, y[i] = func(x[i]), with the AVX-512 or the AVX2
+// implementation of the backend chosen at runtime for the CPU. Unlike the
+// Kokkos overloads, selected at compile time from the Kokkos architecture, they
+// do not require the code to be compiled for the ISA, so that the same binary
+// uses AVX-512 on the CPUs that support it and stays safe on the others.
+
+namespace cexa::dispatch {
+
+enum class isa { scalar, avx2, avx512 };
+
+inline const char* isa_name(isa target) {
+  switch (target) {
+    case isa::avx512: return "avx512";
+    case isa::avx2: return "avx2";
+    default: return "scalar";
+  }
+}
+
+// Best ISA supported by the CPU (and the operating system), which can be
+// lowered with the CEXA_SIMD_DISPATCH_ISA environment variable (scalar, avx2
+// or avx512), e.g. for tests. Other values are ignored with a warning
+inline isa detect_isa() {
+  __builtin_cpu_init();
+  isa detected = isa::scalar;
+  if (__builtin_cpu_supports("avx512f")) {
+    detected = isa::avx512;
+  } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    detected = isa::avx2;
+  }
+
+  const char* requested = std::getenv("CEXA_SIMD_DISPATCH_ISA");
+  if (requested == nullptr || std::strcmp(requested, "avx512") == 0) {
+    return detected;
+  }
+  if (std::strcmp(requested, "scalar") == 0) {
+    detected = isa::scalar;
+  } else if (std::strcmp(requested, "avx2") == 0) {
+    if (detected == isa::avx512) detected = isa::avx2;
+  } else {
+    std::fprintf(stderr,
+                 "cexa::dispatch: ignoring unknown CEXA_SIMD_DISPATCH_ISA=%s "
+                 "(expected scalar, avx2 or avx512), using %s\n",
+                 requested, isa_name(detected));
+  }
+  return detected;
+}
+
+// Detected once, on the first call
+inline isa selected_isa() {
+  static const isa selected = detect_isa();
+  return selected;
+}
+
+// The remainder of the arrays goes through a full vector, padded with ones
+// (in the domain of every function)
+#define CEXA_IMPL_DISPATCH_UNARY_KERNEL(name, isa_target, type, width, \
+                                        load, store, vector_func)      \
+  __attribute__((target(isa_target))) inline void name(                \
+      const type* x, type* y, std::size_t n) {                         \
+    std::size_t i = 0;                                                 \
+    for (; i + width <= n; i += width) {                               \
+      store(y + i, vector_func(load(x + i)));                          \
+    }                                                                  \
+    if (i < n) {                                                       \
+      type x_tail[width];                                              \
+      type y_tail[width];                                              \
+      for (std::size_t j = 0; j < width; j++) {                        \
+        x_tail[j] = i + j < n ? x[i + j] : type(1);                    \
+      }                                                                \
+      store(y_tail, vector_func(load(x_tail)));                        \
+      for (std::size_t j = 0; i + j < n; j++) y[i + j] = y_tail[j];    \
+    }                                                                  \
+  }
+
+#define CEXA_IMPL_DISPATCH_BINARY_KERNEL(name, isa_target, type, width, \
+                                         load, store, vector_func)      \
+  __attribute__((target(isa_target))) inline void name(                 \
+      const type* x, const type* y, type* z, std::size_t n) {           \
+    std::size_t i = 0;                                                  \
+    for (; i + width <= n; i += width) {                                \
+      store(z + i, vector_func(load(x + i), load(y + i)));              \
+    }                                                                   \
+    if (i < n) {                                                        \
+      type x_tail[width];                                               \
+      type y_tail[width];                                               \
+      type z_tail[width];                                               \
+      for (std::size_t j = 0; j < width; j++) {                         \
+        x_tail[j] = i + j < n ? x[i + j] : type(1);                     \
+        y_tail[j] = i + j < n ? y[i + j] : type(1);                     \
+      }                                                                 \
+      store(z_tail, vector_func(load(x_tail), load(y_tail)));           \
+      for (std::size_t j = 0; i + j < n; j++) z[i + j] = z_tail[j];     \
+    }                                                                   \
+  }
+
+// The vector functions are declared here rather than taken from the backend
+// headers, which only declare the ones of the ISA of the compilation
+#define CEXA_IMPL_DISPATCH_UNARY_FUNCTION(func, avx2_double, avx2_float, \
+                                          avx512_double, avx512_float)   \
+  extern "C" __m256d avx2_double(__m256d);                               \
+  extern "C" __m256 avx2_float(__m256);                                  \
+  extern "C" __m512d avx512_double(__m512d);                             \
+  extern "C" __m512 avx512_float(__m512);                                \
+  namespace impl {                                                       \
+  CEXA_IMPL_DISPATCH_UNARY_KERNEL(func##_avx2, "avx2,fma", double, 4,    \
+                                  _mm256_loadu_pd, _mm256_storeu_pd,     \
+                                  avx2_double)                           \
+  CEXA_IMPL_DISPATCH_UNARY_KERNEL(func##_avx2, "avx2,fma", float, 8,     \
+                                  _mm256_loadu_ps, _mm256_storeu_ps,     \
+                                  avx2_float)                            \
+  CEXA_IMPL_DISPATCH_UNARY_KERNEL(func##_avx512, "avx512f", double, 8,   \
+                                  _mm512_loadu_pd, _mm512_storeu_pd,     \
+                                  avx512_double)                         \
+  CEXA_IMPL_DISPATCH_UNARY_KERNEL(func##_avx512, "avx512f", float, 16,   \
+                                  _mm512_loadu_ps, _mm512_storeu_ps,     \
+                                  avx512_float)                          \
+  template <class T>                                                     \
+  void func##_scalar(const T* x, T* y, std::size_t n) {                  \
+    for (std::size_t i = 0; i < n; i++) y[i] = std::func(x[i]);          \
+  }                                                                      \
+  template <class T>                                                     \
+  void func(const T* x, T* y, std::size_t n, isa target) {               \
+    switch (target) {                                                    \
+      case isa::avx512: func##_avx512(x, y, n); break;                   \
+      case isa::avx2: func##_avx2(x, y, n); break;                       \
+      default: func##_scalar(x, y, n);                                   \
+    }                                                                    \
+  }                                                                      \
+  }                                                                      \
+  inline void func(const double* x, double* y, std::size_t n,            \
+                   isa target = selected_isa()) {                        \
+    impl::func(x, y, n, target);                                         \
+  }                                                                      \
+  inline void func(const float* x, float* y, std::size_t n,              \
+                   isa target = selected_isa()) {                        \
+    impl::func(x, y, n, target);                                         \
+  }
+
+#define CEXA_IMPL_DISPATCH_BINARY_FUNCTION(func, avx2_double, avx2_float,   \
+                                           avx512_double, avx512_float)     \
+  extern "C" __m256d avx2_double(__m256d, __m256d);                         \
+  extern "C" __m256 avx2_float(__m256, __m256);                             \
+  extern "C" __m512d avx512_double(__m512d, __m512d);                       \
+  extern "C" __m512 avx512_float(__m512, __m512);                           \
+  namespace impl {                                                          \
+  CEXA_IMPL_DISPATCH_BINARY_KERNEL(func##_avx2, "avx2,fma", double, 4,      \
+                                   _mm256_loadu_pd, _mm256_storeu_pd,       \
+                                   avx2_double)                             \
+  CEXA_IMPL_DISPATCH_BINARY_KERNEL(func##_avx2, "avx2,fma", float, 8,       \
+                                   _mm256_loadu_ps, _mm256_storeu_ps,       \
+                                   avx2_float)                              \
+  CEXA_IMPL_DISPATCH_BINARY_KERNEL(func##_avx512, "avx512f", double, 8,     \
+                                   _mm512_loadu_pd, _mm512_storeu_pd,       \
+                                   avx512_double)                           \
+  CEXA_IMPL_DISPATCH_BINARY_KERNEL(func##_avx512, "avx512f", float, 16,     \
+                                   _mm512_loadu_ps, _mm512_storeu_ps,       \
+                                   avx512_float)                            \
+  template <class T>                                                        \
+  void func##_scalar(const T* x, const T* y, T* z, std::size_t n) {         \
+    for (std::size_t i = 0; i < n; i++) z[i] = std::func(x[i], y[i]);       \
+  }                                                                         \
+  template <class T>                                                        \
+  void func(const T* x, const T* y, T* z, std::size_t n, isa target) {      \
+    switch (target) {                                                       \
+      case isa::avx512: func##_avx512(x, y, z, n); break;                   \
+      case isa::avx2: func##_avx2(x, y, z, n); break;                       \
+      default: func##_scalar(x, y, z, n);                                   \
+    }                                                                       \
+  }                                                                         \
+  }                                                                         \
+  inline void func(const double* x, const double* y, double* z,             \
+                   std::size_t n, isa target = selected_isa()) {            \
+    impl::func(x, y, z, n, target);                                         \
+  }                                                                         \
+  inline void func(const float* x, const float* y, float* z, std::size_t n, \
+                   isa target = selected_isa()) {                           \
+    impl::func(x, y, z, n, target);                                         \
+  }
+
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+
+// The precision of the calls without a tag, see CEXA_SIMD_SLEEF_FAST
+#if defined(CEXA_SIMD_SLEEF_FAST)
+#define CEXA_IMPL_DISPATCH_SLEEF_PRECISION(prec, fast_prec) fast_prec
+#else
+#define CEXA_IMPL_DISPATCH_SLEEF_PRECISION(prec, fast_prec) prec
+#endif
+
+#define CEXA_IMPL_DISPATCH_SLEEF_FUNCTION_IMPL(kind, func, prec) \
+  CEXA_IMPL_DISPATCH_##kind##_FUNCTION(                          \
+      func, Sleef_finz_##func##d4_##prec##avx2,                  \
+      Sleef_finz_##func##f8_##prec##avx2,                        \
+      Sleef_finz_##func##d8_##prec##avx512f,                     \
+      Sleef_finz_##func##f16_##prec##avx512f)
+#define CEXA_IMPL_DISPATCH_SLEEF_FUNCTION(kind, func, prec) \
+  CEXA_IMPL_DISPATCH_SLEEF_FUNCTION_IMPL(kind, func, prec)
+
+#define CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(func, prec, fast_prec) \
+  CEXA_IMPL_DISPATCH_SLEEF_FUNCTION(                                   \
+      UNARY, func, CEXA_IMPL_DISPATCH_SLEEF_PRECISION(prec, fast_prec))
+#define CEXA_IMPL_DISPATCH_SLEEF_BINARY_FUNCTION(func, prec, fast_prec) \
+  CEXA_IMPL_DISPATCH_SLEEF_FUNCTION(                                    \
+      BINARY, func, CEXA_IMPL_DISPATCH_SLEEF_PRECISION(prec, fast_prec))
+
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(exp, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(exp2, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(log, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(log10, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(log2, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(cbrt, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(sin, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(cos, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(tan, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(asin, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(acos, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(atan, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(sinh, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(cosh, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(tanh, u10, u35)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(asinh, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(acosh, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(atanh, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(erf, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(erfc, u15, u15)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(tgamma, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION(lgamma, u10, u10)
+
+CEXA_IMPL_DISPATCH_SLEEF_BINARY_FUNCTION(pow, u10, u10)
+CEXA_IMPL_DISPATCH_SLEEF_BINARY_FUNCTION(hypot, u05, u35)
+CEXA_IMPL_DISPATCH_SLEEF_BINARY_FUNCTION(atan2, u10, u35)
+
+#undef CEXA_IMPL_DISPATCH_SLEEF_PRECISION
+#undef CEXA_IMPL_DISPATCH_SLEEF_FUNCTION_IMPL
+#undef CEXA_IMPL_DISPATCH_SLEEF_FUNCTION
+#undef CEXA_IMPL_DISPATCH_SLEEF_UNARY_FUNCTION
+#undef CEXA_IMPL_DISPATCH_SLEEF_BINARY_FUNCTION
+
+#elif defined(CEXA_SIMD_ENABLE_LIBMVEC)
+
+// See CEXA_SIMD_LIBMVEC.hpp for the names of the vector functions
+#define CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(func)                  \
+  CEXA_IMPL_DISPATCH_UNARY_FUNCTION(func, _ZGVdN4v_##func,               \
+                                    _ZGVdN8v_##func##f, _ZGVeN8v_##func, \
+                                    _ZGVeN16v_##func##f)
+#define CEXA_IMPL_DISPATCH_LIBMVEC_BINARY_FUNCTION(func)                    \
+  CEXA_IMPL_DISPATCH_BINARY_FUNCTION(func, _ZGVdN4vv_##func,                \
+                                     _ZGVdN8vv_##func##f, _ZGVeN8vv_##func, \
+                                     _ZGVeN16vv_##func##f)
+
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(exp)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(log)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(sin)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(cos)
+CEXA_IMPL_DISPATCH_LIBMVEC_BINARY_FUNCTION(pow)
+#if __GLIBC_PREREQ(2, 35)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(exp2)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(log10)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(log2)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(cbrt)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(tan)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(asin)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(acos)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(atan)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(sinh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(cosh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(tanh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(asinh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(acosh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(atanh)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(erf)
+CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION(erfc)
+CEXA_IMPL_DISPATCH_LIBMVEC_BINARY_FUNCTION(hypot)
+CEXA_IMPL_DISPATCH_LIBMVEC_BINARY_FUNCTION(atan2)
+#endif
+
+#undef CEXA_IMPL_DISPATCH_LIBMVEC_UNARY_FUNCTION
+#undef CEXA_IMPL_DISPATCH_LIBMVEC_BINARY_FUNCTION
+
+#endif
+
+}  // namespace cexa::dispatch
+
+#undef CEXA_IMPL_DISPATCH_UNARY_KERNEL
+#undef CEXA_IMPL_DISPATCH_BINARY_KERNEL
+#undef CEXA_IMPL_DISPATCH_UNARY_FUNCTION
+#undef CEXA_IMPL_DISPATCH_BINARY_FUNCTION
+
+#endif
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_SIMD_LIBMVEC_HPP
+#define CEXA_SIMD_LIBMVEC_HPP
+
+#include <Kokkos_Macros.hpp>
+#if defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX512XEON)
+#include <immintrin.h>
+#endif
+// For __GLIBC_PREREQ
+#include <features.h>
+
+// exp, log, sin, cos and pow are in libmvec since glibc 2.22, the other
+// functions since glibc 2.35
+#if __GLIBC_PREREQ(2, 35)
+#define CEXA_IMPL_LIBMVEC_GLIBC_2_35 1
+#else
+#define CEXA_IMPL_LIBMVEC_GLIBC_2_35 0
+#endif
+
+namespace Kokkos {
+
+// NOTE: If a function is commented out, it means that the accelerated version
+// is already available in Kokkos SIMD, either through auto-vectorization or
+// call to the associated intrinsic.
+// The libmvec functions follow the x86_64 vector function ABI: _ZGV, the ISA
+// (b for SSE, d for AVX2, e for AVX-512), N, the number of lanes, v for each
+// vector argument, and the name of the scalar function. Their maximum error is
+// 4 ULP.
+
+#if defined(KOKKOS_ARCH_AVX2)
+
+#include <Kokkos_SIMD_AVX2.hpp>
+
+#define CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(func)                        \
+  extern "C" __m256d _ZGVdN4v_##func(__m256d);                             \
+  extern "C" __m128 _ZGVbN4v_##func##f(__m128);                            \
+  extern "C" __m256 _ZGVdN8v_##func##f(__m256);                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::basic_simd<double,                                     \
+                               Experimental::simd_abi::avx2_fixed_size<4>> \
+      func(Experimental::basic_simd<                                       \
+           double, Experimental::simd_abi::avx2_fixed_size<4>> const& a) { \
+    return Experimental::basic_simd<                                       \
+        double, Experimental::simd_abi::avx2_fixed_size<4>>(               \
+        _ZGVdN4v_##func(static_cast<__m256d>(a)));                         \
+  }                                                                        \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::basic_simd<float,                                      \
+                               Experimental::simd_abi::avx2_fixed_size<4>> \
+      func(Experimental::basic_simd<                                       \
+           float, Experimental::simd_abi::avx2_fixed_size<4>> const& a) {  \
+    return Experimental::basic_simd<                                       \
+        float, Experimental::simd_abi::avx2_fixed_size<4>>(                \
+        _ZGVbN4v_##func##f(static_cast<__m128>(a)));                       \
+  }                                                                        \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::basic_simd<float,                                      \
+                               Experimental::simd_abi::avx2_fixed_size<8>> \
+      func(Experimental::basic_simd<                                       \
+           float, Experimental::simd_abi::avx2_fixed_size<8>> const& a) {  \
+    return Experimental::basic_simd<                                       \
+        float, Experimental::simd_abi::avx2_fixed_size<8>>(                \
+        _ZGVdN8v_##func##f(static_cast<__m256>(a)));                       \
+  }
+
+// CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(abs)
+// There are already calls to the svml intrinsics for these functions in kokkos
+// simd when using an intel compiler
+#if KOKKOS_VERSION_LESS(5, 0, 0) || !defined(KOKKOS_COMPILER_INTEL_LLVM)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(exp)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(log)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(cbrt)
+#endif
+#endif
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(sin)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(cos)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(exp2)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(log10)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(log2)
+// CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(sqrt)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(tan)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(asin)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(acos)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(atan)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(sinh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(cosh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(tanh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(asinh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(acosh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(atanh)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(erf)
+CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(erfc)
+#endif
+// Not provided by libmvec
+// CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(tgamma)
+// CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION(lgamma)
+
+#define CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION(func)                           \
+  extern "C" __m256d _ZGVdN4vv_##func(__m256d, __m256d);                       \
+  extern "C" __m128 _ZGVbN4vv_##func##f(__m128, __m128);                       \
+  extern "C" __m256 _ZGVdN8vv_##func##f(__m256, __m256);                       \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<double,                                         \
+                               Experimental::simd_abi::avx2_fixed_size<4>>     \
+      func(Experimental::basic_simd<                                           \
+               double, Experimental::simd_abi::avx2_fixed_size<4>> const& a,   \
+           Experimental::basic_simd<                                           \
+               double, Experimental::simd_abi::avx2_fixed_size<4>> const& b) { \
+    return Experimental::basic_simd<                                           \
+        double, Experimental::simd_abi::avx2_fixed_size<4>>(                   \
+        _ZGVdN4vv_##func(static_cast<__m256d>(a), static_cast<__m256d>(b)));   \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<float,                                          \
+                               Experimental::simd_abi::avx2_fixed_size<4>>     \
+      func(Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx2_fixed_size<4>> const& a,    \
+           Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx2_fixed_size<4>> const& b) {  \
+    return Experimental::basic_simd<                                           \
+        float, Experimental::simd_abi::avx2_fixed_size<4>>(                    \
+        _ZGVbN4vv_##func##f(static_cast<__m128>(a), static_cast<__m128>(b)));  \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<float,                                          \
+                               Experimental::simd_abi::avx2_fixed_size<8>>     \
+      func(Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx2_fixed_size<8>> const& a,    \
+           Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx2_fixed_size<8>> const& b) {  \
+    return Experimental::basic_simd<                                           \
+        float, Experimental::simd_abi::avx2_fixed_size<8>>(                    \
+        _ZGVdN8vv_##func##f(static_cast<__m256>(a),                            \
+                            static_cast<__m256>(b)));                          \
+  }
+
+CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION(pow)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION(hypot)
+CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION(atan2)
+#endif
+// CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION(copysign)
+
+#elif defined(KOKKOS_ARCH_AVX512XEON)
+
+#include <Kokkos_SIMD_AVX512.hpp>
+
+#define CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(func)                         \
+  extern "C" __m512d _ZGVeN8v_##func(__m512d);                                \
+  extern "C" __m512 _ZGVeN16v_##func##f(__m512);                              \
+  extern "C" __m256 _ZGVdN8v_##func##f(__m256);                               \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      Experimental::basic_simd<double,                                        \
+                               Experimental::simd_abi::avx512_fixed_size<8>>  \
+      func(Experimental::basic_simd<                                          \
+           double, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {  \
+    return Experimental::basic_simd<                                          \
+        double, Experimental::simd_abi::avx512_fixed_size<8>>(                \
+        _ZGVeN8v_##func(static_cast<__m512d>(a)));                            \
+  }                                                                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      Experimental::basic_simd<float,                                         \
+                               Experimental::simd_abi::avx512_fixed_size<16>> \
+      func(Experimental::basic_simd<                                          \
+           float, Experimental::simd_abi::avx512_fixed_size<16>> const& a) {  \
+    return Experimental::basic_simd<                                          \
+        float, Experimental::simd_abi::avx512_fixed_size<16>>(                \
+        _ZGVeN16v_##func##f(static_cast<__m512>(a)));                         \
+  }                                                                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                         \
+      Experimental::basic_simd<float,                                         \
+                               Experimental::simd_abi::avx512_fixed_size<8>>  \
+      func(Experimental::basic_simd<                                          \
+           float, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {   \
+    return Experimental::basic_simd<                                          \
+        float, Experimental::simd_abi::avx512_fixed_size<8>>(                 \
+        _ZGVdN8v_##func##f(static_cast<__m256>(a)));                          \
+  }
+
+// CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(abs)
+// There are already calls to the svml intrinsics for these functions in kokkos
+// simd when using an intel compiler
+#if KOKKOS_VERSION_LESS(5, 0, 0) || !defined(KOKKOS_COMPILER_INTEL_LLVM)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(exp)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(log)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(cbrt)
+#endif
+#endif
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(sin)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(cos)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(exp2)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(log10)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(log2)
+// CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(sqrt)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(tan)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(asin)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(acos)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(atan)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(sinh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(cosh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(tanh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(asinh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(acosh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(atanh)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(erf)
+CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(erfc)
+#endif
+// Not provided by libmvec
+// CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(tgamma)
+// CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION(lgamma)
+
+#define CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION(func)                         \
+  extern "C" __m512d _ZGVeN8vv_##func(__m512d, __m512d);                       \
+  extern "C" __m512 _ZGVeN16vv_##func##f(__m512, __m512);                      \
+  extern "C" __m256 _ZGVdN8vv_##func##f(__m256, __m256);                       \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<double,                                         \
+                               Experimental::simd_abi::avx512_fixed_size<8>>   \
+      func(Experimental::basic_simd<                                           \
+               double, Experimental::simd_abi::avx512_fixed_size<8>> const& a, \
+           Experimental::basic_simd<                                           \
+               double, Experimental::simd_abi::avx512_fixed_size<8>> const&    \
+               b) {                                                            \
+    return Experimental::basic_simd<                                           \
+        double, Experimental::simd_abi::avx512_fixed_size<8>>(                 \
+        _ZGVeN8vv_##func(static_cast<__m512d>(a),                              \
+                         static_cast<__m512d>(b)));                            \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<float,                                          \
+                               Experimental::simd_abi::avx512_fixed_size<16>>  \
+      func(Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx512_fixed_size<16>> const& a, \
+           Experimental::basic_simd<                                           \
+               float, Experimental::simd_abi::avx512_fixed_size<16>> const&    \
+               b) {                                                            \
+    return Experimental::basic_simd<                                           \
+        float, Experimental::simd_abi::avx512_fixed_size<16>>(                 \
+        _ZGVeN16vv_##func##f(static_cast<__m512>(a),                           \
+                             static_cast<__m512>(b)));                         \
+  }                                                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                          \
+      Experimental::basic_simd<float,                                          \
+                               Experimental::simd_abi::avx512_fixed_size<8>>   \
+      func(                                                                    \
+          Experimental::basic_simd<                                            \
+              float, Experimental::simd_abi::avx512_fixed_size<8>> const& a,   \
+          Experimental::basic_simd<                                            \
+              float, Experimental::simd_abi::avx512_fixed_size<8>> const& b) { \
+    return Experimental::basic_simd<                                           \
+        float, Experimental::simd_abi::avx512_fixed_size<8>>(                  \
+        _ZGVdN8vv_##func##f(static_cast<__m256>(a),                            \
+                            static_cast<__m256>(b)));                          \
+  }
+
+CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION(pow)
+#if CEXA_IMPL_LIBMVEC_GLIBC_2_35
+CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION(hypot)
+CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION(atan2)
+#endif
+// CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION(copysign)
+
+#endif
+
+}  // namespace Kokkos
+
+#undef CEXA_IMPL_LIBMVEC_AVX2_UNARY_FUNCTION
+#undef CEXA_IMPL_LIBMVEC_AVX2_BINARY_FUNCTION
+
+#undef CEXA_IMPL_LIBMVEC_AVX512_UNARY_FUNCTION
+#undef CEXA_IMPL_LIBMVEC_AVX512_BINARY_FUNCTION
+
+#undef CEXA_IMPL_LIBMVEC_GLIBC_2_35
+
+#endif
@@ -0,0 +1,613 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#ifndef CEXA_SIMD_PORTABLE_HPP
+#define CEXA_SIMD_PORTABLE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Vectorized math functions written with the basic_simd arithmetic and masks
+// only, for any simd ABI: range reduction followed by polynomials fitted on the
+// reduced range. Maximum errors relative to the correctly rounded results:
+// - exp:      1.1 ULP
+// - log:      1 ULP
+// - sin, cos: 2.5 ULP (the C library beyond |x| = 2^19, 2^13 for float)
+// - tanh:     1.5 ULP
+// - erf:      2.5 ULP
+// - pow:      2 ULP
+// pow uses double-double (float-float) arithmetic, which requires the
+// compilation without -ffast-math (or -fassociative-math).
+
+namespace cexa::portable {
+
+namespace impl {
+
+template <class T>
+struct constants;
+
+template <>
+struct constants<double> {
+  using bits_type = std::int64_t;
+
+  // Polynomials, by increasing degree
+  // (exp(r) - 1 - r) / r^2 for |r| <= ln(2) / 2
+  static constexpr double exp[] = {
+      0.5,                    0.1666666666666667,     0.04166666666666667,
+      0.008333333333326127,   0.0013888888888882905,  0.0001984126987484558,
+      2.4801587327801084e-05, 2.7557255368562957e-06, 2.755727122863106e-07,
+      2.5105230170824773e-08, 2.0915581025151344e-09};
+  // (atanh(s) / s - 1) / z for z = s^2 <= 0.0295
+  static constexpr double log[] = {
+      0.3333333333333335,  0.19999999999949095, 0.14285714313285103,
+      0.11111105518908294, 0.09091448091741543, 0.07665743617932867,
+      0.07309671726756307};
+  // (atanh(s) / s - 1 - z / 3) / z^2 for z = s^2 <= 0.0295, for pow
+  static constexpr double log_extended[] = {
+      0.2,                 0.1428571428571469,  0.1111111111082441,
+      0.09090909168496285, 0.07692297395881176, 0.06667406985646002,
+      0.058529940782504536, 0.05862885610905572};
+  // (sin(r) - r) / r^3 for z = r^2 <= (pi / 4)^2
+  static constexpr double sin[] = {
+      -0.16666666666666666,  0.008333333333330887,   -0.0001984126983666588,
+      2.755731605459391e-06, -2.5051121875169608e-08, 1.5917412836707387e-10};
+  // (cos(r) - 1 + r^2 / 2) / r^4 for z = r^2 <= (pi / 4)^2
+  static constexpr double cos[] = {
+      0.041666666666666664,  -0.0013888888888887359, 2.48015872987077e-05,
+      -2.755731724172776e-07, 2.0876140031390975e-09, -1.138218421447753e-11};
+  // (tanh(x) - x) / x^3 for z = x^2 <= 0.625^2
+  static constexpr double tanh[] = {
+      -0.3333333333333332,    0.13333333333326647,     -0.053968253961384736,
+      0.021869488260176276,   -0.008863229824094,      0.003592058907770886,
+      -0.0014553088663318695, 0.0005874356408905726,   -0.00023077238182345804,
+      7.959476025492855e-05,  -1.724229434740653e-05};
+  // erf(x) / x for z = x^2 <= 1
+  static constexpr double erf_small[] = {
+      1.1283791670955126,     -0.37612638903183543,  0.11283791670945006,
+      -0.02686617064323777,   0.0052239776071164225, -0.0008548325975389692,
+      0.00012055294904839707, -1.492473690741966e-05, 1.6447424703317362e-06,
+      -1.6208483801871705e-07, 1.3720064546777686e-08,
+      -7.795898827002142e-10};
+  // erfc(x) exp(x^2) for 1 <= x <= erf_max, of t - erf_shift with
+  // t = 1 / (1 + erf_scale x)
+  static constexpr double erf_large[] = {
+      0.20463652080158568,   0.7383689219368426,   1.2283364647523731,
+      1.6787819363728738,    1.846199568208587,    1.5590547832532355,
+      0.8976272925741637,    0.2017606778514187,   -0.1748989796352246,
+      -0.16126946515024862,  0.006536538202863772, 0.07211283454652354,
+      0.013025076201903097,  -0.031047646374905202, -0.00865079999110088};
+  static constexpr double erf_scale = 0.3;
+  static constexpr double erf_shift = 0.5631868131868132;
+  // erf(x) rounds to 1 above
+  static constexpr double erf_max = 6.;
+
+  // ln(2) and pi / 2 split so that their products by the integers of the
+  // range reductions are exact
+  static constexpr double ln2_hi          = 0.6931471803691238;
+  static constexpr double ln2_lo          = 1.9082149292705877e-10;
+  static constexpr double pi_2_1          = 1.5707963267341256;
+  static constexpr double pi_2_2          = 6.077100506303966e-11;
+  static constexpr double pi_2_3          = 2.0222662487111665e-21;
+  static constexpr double pi_2_4          = 8.4784276603689e-32;
+  static constexpr double two_thirds_hi   = 0.6666666666666666;
+  static constexpr double two_thirds_lo   = 3.700743415417188e-17;
+  static constexpr double log2e           = 1.4426950408889634;
+  static constexpr double two_over_pi     = 0.6366197723675814;
+  static constexpr double sqrt2           = 1.4142135623730951;
+  static constexpr double sin_max         = 524288.;
+  static constexpr double tanh_min        = 0.625;
+  static constexpr double exp_max         = 709.782712893384;
+  static constexpr double exp_min         = -745.1332191019412;
+  static constexpr double subnormal       = 18014398509481984.;  // 2^54
+  static constexpr int subnormal_exponent = 54;
+};
+
+template <>
+struct constants<float> {
+  using bits_type = std::int32_t;
+
+  static constexpr float exp[] = {0.5f, 0.166665763f, 0.0416665487f,
+                                  0.00836318638f, 0.00139266904f};
+  static constexpr float log[] = {0.333333433f, 0.199943662f, 0.147910789f};
+  static constexpr float log_extended[] = {0.200000003f, 0.142857656f,
+                                           0.111023448f, 0.0956121534f};
+  static constexpr float sin[] = {-0.166666642f, 0.00833274238f,
+                                  -0.000195866058f};
+  static constexpr float cos[] = {0.0416666642f, -0.00138882967f,
+                                  2.45466545e-05f};
+  static constexpr float tanh[] = {-0.333333343f,  0.133333042f,
+                                   -0.0539592542f, 0.021768868f,
+                                   -0.00834378041f, 0.00229255762f};
+  static constexpr float erf_small[] = {
+      1.12837911f,    -0.37612626f,    0.112835944f,  -0.0268542115f,
+      0.00518908724f, -0.00080168643f, 7.87587487e-05f};
+  static constexpr float erf_large[] = {0.243714184f, 0.870855927f,
+                                        1.50176346f,  2.07745838f,
+                                        2.25864553f,  1.83515882f,
+                                        0.942758918f};
+  static constexpr float erf_scale = 0.3f;
+  static constexpr float erf_shift = 0.611888111f;
+  static constexpr float erf_max   = 4.f;
+
+  static constexpr float ln2_hi           = 0.693145752f;
+  static constexpr float ln2_lo           = 1.42860677e-06f;
+  static constexpr float pi_2_1           = 1.5703125f;
+  static constexpr float pi_2_2           = 0.000483751297f;
+  static constexpr float pi_2_3           = 7.54953362e-08f;
+  static constexpr float pi_2_4           = 2.56334407e-12f;
+  static constexpr float two_thirds_hi    = 0.666666687f;
+  static constexpr float two_thirds_lo    = -1.98682155e-08f;
+  static constexpr float log2e            = 1.44269502f;
+  static constexpr float two_over_pi      = 0.636619747f;
+  static constexpr float sqrt2            = 1.41421354f;
+  static constexpr float sin_max          = 8192.f;
+  static constexpr float tanh_min         = 0.625f;
+  static constexpr float exp_max          = 88.7228394f;
+  static constexpr float exp_min          = -103.972084f;
+  static constexpr float subnormal        = 33554432.f;  // 2^25
+  static constexpr int subnormal_exponent = 25;
+};
+
+template <class T, class Abi>
+using simd = Kokkos::Experimental::basic_simd<T, Abi>;
+template <class T, class Abi>
+using simd_mask = typename simd<T, Abi>::mask_type;
+
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> select(
+    const simd_mask<T, Abi>& mask, const simd<T, Abi>& a, simd<T, Abi> b) {
+  Kokkos::Experimental::where(mask, b) = a;
+  return b;
+}
+
+// Horner scheme, with coefficients by increasing degree
+template <class T, class Abi, std::size_t N>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> polynomial(
+    const simd<T, Abi>& x, const T (&coefficients)[N]) {
+  simd<T, Abi> result(coefficients[N - 1]);
+  for (std::size_t i = N - 1; i > 0; i--) {
+    result = result * x + coefficients[i - 1];
+  }
+  return result;
+}
+
+// 2^n for integers n in the range of the normal exponents, built lane by lane
+// in the exponent bits (a loop the compilers vectorize)
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> exp2_int(
+    const simd<T, Abi>& n) {
+  using bits_type              = typename constants<T>::bits_type;
+  constexpr std::size_t size   = simd<T, Abi>::size();
+  constexpr int mantissa_bits  = std::numeric_limits<T>::digits - 1;
+  constexpr bits_type exponent = std::numeric_limits<T>::max_exponent - 1;
+
+  T values[size];
+  n.copy_to(values, Kokkos::Experimental::simd_flag_default);
+  for (std::size_t i = 0; i < size; i++) {
+    bits_type bits = (bits_type(values[i]) + exponent) << mantissa_bits;
+    std::memcpy(&values[i], &bits, sizeof(T));
+  }
+  return simd<T, Abi>(values, Kokkos::Experimental::simd_flag_default);
+}
+
+// x = m 2^e with m in [1, 2), for positive normal x
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void frexp(const simd<T, Abi>& x,
+                                                 simd<T, Abi>& m,
+                                                 simd<T, Abi>& e) {
+  using bits_type              = typename constants<T>::bits_type;
+  constexpr std::size_t size   = simd<T, Abi>::size();
+  constexpr int mantissa_bits  = std::numeric_limits<T>::digits - 1;
+  constexpr bits_type exponent = std::numeric_limits<T>::max_exponent - 1;
+  constexpr bits_type mantissa = (bits_type(1) << mantissa_bits) - 1;
+
+  T m_values[size];
+  T e_values[size];
+  x.copy_to(m_values, Kokkos::Experimental::simd_flag_default);
+  for (std::size_t i = 0; i < size; i++) {
+    bits_type bits;
+    std::memcpy(&bits, &m_values[i], sizeof(T));
+    e_values[i] = T((bits >> mantissa_bits) - exponent);
+    bits        = (bits & mantissa) | (exponent << mantissa_bits);
+    std::memcpy(&m_values[i], &bits, sizeof(T));
+  }
+  m = simd<T, Abi>(m_values, Kokkos::Experimental::simd_flag_default);
+  e = simd<T, Abi>(e_values, Kokkos::Experimental::simd_flag_default);
+}
+
+// func on the lanes of mask, e.g. for the arguments out of the range of a
+// range reduction
+template <class T, class Abi, class Func>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> scalar_fallback(
+    const simd_mask<T, Abi>& mask, const simd<T, Abi>& x,
+    const simd<T, Abi>& result, Func func) {
+  constexpr std::size_t size = simd<T, Abi>::size();
+
+  T x_values[size];
+  T values[size];
+  x.copy_to(x_values, Kokkos::Experimental::simd_flag_default);
+  result.copy_to(values, Kokkos::Experimental::simd_flag_default);
+  for (std::size_t i = 0; i < size; i++) {
+    if (mask[i]) {
+      values[i] = func(x_values[i]);
+    }
+  }
+  return simd<T, Abi>(values, Kokkos::Experimental::simd_flag_default);
+}
+
+// Error free transformations: a + b = hi + lo and a * b = hi + lo
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void two_sum(const simd<T, Abi>& a,
+                                                   const simd<T, Abi>& b,
+                                                   simd<T, Abi>& hi,
+                                                   simd<T, Abi>& lo) {
+  hi                = a + b;
+  simd<T, Abi> b_hi = hi - a;
+  lo                = (a - (hi - b_hi)) + (b - b_hi);
+}
+
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void two_product(const simd<T, Abi>& a,
+                                                       const simd<T, Abi>& b,
+                                                       simd<T, Abi>& hi,
+                                                       simd<T, Abi>& lo) {
+  hi = a * b;
+  lo = Kokkos::fma(a, b, -hi);
+}
+
+// exp(hi + lo) with |lo| <= ulp(hi)
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> exp(const simd<T, Abi>& hi,
+                                                       const simd<T, Abi>& lo) {
+  using c = constants<T>;
+
+  // The lanes out of range are computed with 0 and fixed at the end
+  auto in_range  = (hi > c::exp_min) && (hi <= c::exp_max);
+  simd<T, Abi> x = select(in_range, hi, simd<T, Abi>(T(0)));
+
+  // x = n ln(2) + r with |r| <= ln(2) / 2
+  simd<T, Abi> n = Kokkos::round(x * c::log2e);
+  simd<T, Abi> r = (x - n * c::ln2_hi) - n * c::ln2_lo + lo;
+
+  simd<T, Abi> result = T(1) + (r + r * r * polynomial(r, c::exp));
+
+  // 2^n in two factors, so that the subnormal and the largest results do not
+  // need exponents out of the normal range
+  simd<T, Abi> n_1 = Kokkos::floor(n * T(0.5));
+  result           = result * exp2_int(n_1) * exp2_int(n - n_1);
+
+  result = select(hi > c::exp_max,
+                  simd<T, Abi>(std::numeric_limits<T>::infinity()), result);
+  result = select(hi <= c::exp_min, simd<T, Abi>(T(0)), result);
+  return select(hi != hi, hi, result);
+}
+
+// x = (1 + f) 2^e with 1 + f in [sqrt(2) / 2, sqrt(2)), for positive finite x
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void log_reduce(const simd<T, Abi>& x,
+                                                      simd<T, Abi>& f,
+                                                      simd<T, Abi>& e) {
+  using c = constants<T>;
+
+  auto subnormal = x < std::numeric_limits<T>::min();
+  simd<T, Abi> m;
+  frexp(select(subnormal, x * c::subnormal, x), m, e);
+  e = select(subnormal, e - T(c::subnormal_exponent), e);
+
+  auto large = m > c::sqrt2;
+  m          = select(large, m * T(0.5), m);
+  e          = select(large, e + T(1), e);
+  f          = m - T(1);
+}
+
+// log(x) for positive finite x
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> log(const simd<T, Abi>& x) {
+  using c = constants<T>;
+
+  simd<T, Abi> f;
+  simd<T, Abi> e;
+  log_reduce(x, f, e);
+
+  // log(1 + f) = 2 atanh(s) = f - f^2 / 2 + s (f^2 / 2 + 2 s^2 R(s^2)) with
+  // s = f / (2 + f), where the first term is exact
+  simd<T, Abi> s    = f / (T(2) + f);
+  simd<T, Abi> z    = s * s;
+  simd<T, Abi> hfsq = T(0.5) * f * f;
+  simd<T, Abi> r    = T(2) * z * polynomial(z, c::log);
+
+  return e * c::ln2_hi - ((hfsq - (s * (hfsq + r) + e * c::ln2_lo)) - f);
+}
+
+// log(x) = hi + lo to about twice the precision of T, for positive finite x
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void log(const simd<T, Abi>& x,
+                                               simd<T, Abi>& hi,
+                                               simd<T, Abi>& lo) {
+  using c = constants<T>;
+
+  simd<T, Abi> f;
+  simd<T, Abi> e;
+  log_reduce(x, f, e);
+
+  // s = f / (2 + f) = s_hi + s_lo
+  simd<T, Abi> d_hi = T(2) + f;
+  simd<T, Abi> d_lo = f - (d_hi - T(2));
+  simd<T, Abi> s_hi = f / d_hi;
+  simd<T, Abi> s_lo = (Kokkos::fma(-s_hi, d_hi, f) - s_hi * d_lo) / d_hi;
+
+  // log(1 + f) = 2 atanh(s) = 2 s + 2 s^3 / 3 + 2 s^5 R(s^2), with the second
+  // term in double-T precision
+  simd<T, Abi> z_hi;
+  simd<T, Abi> z_lo;
+  two_product(s_hi, s_hi, z_hi, z_lo);
+  simd<T, Abi> cube_hi;
+  simd<T, Abi> cube_lo;
+  two_product(s_hi, z_hi, cube_hi, cube_lo);
+  cube_lo = cube_lo + s_hi * z_lo + T(3) * z_hi * s_lo;
+  simd<T, Abi> t_hi;
+  simd<T, Abi> t_lo;
+  two_product(cube_hi, simd<T, Abi>(c::two_thirds_hi), t_hi, t_lo);
+  t_lo = t_lo + cube_lo * c::two_thirds_hi + cube_hi * c::two_thirds_lo;
+  simd<T, Abi> tail =
+      T(2) * cube_hi * z_hi * polynomial(z_hi, c::log_extended);
+
+  simd<T, Abi> log1p_hi;
+  simd<T, Abi> log1p_lo;
+  two_sum(simd<T, Abi>(T(2) * s_hi), t_hi, log1p_hi, log1p_lo);
+  simd<T, Abi> sum_lo;
+  two_sum(simd<T, Abi>(e * c::ln2_hi), log1p_hi, hi, sum_lo);
+  lo = sum_lo +
+       (log1p_lo + (e * c::ln2_lo + (T(2) * s_lo + (t_lo + tail))));
+
+  // Renormalized
+  simd<T, Abi> sum = hi + lo;
+  lo               = lo - (sum - hi);
+  hi               = sum;
+}
+
+template <class T, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<T, Abi> sin_cos(
+    const simd<T, Abi>& x, T quadrant_offset) {
+  using c = constants<T>;
+
+  // Beyond sin_max, the products of the range reduction are no longer exact
+  auto out_of_range = !(Kokkos::abs(x) <= c::sin_max);
+  simd<T, Abi> a    = select(out_of_range, simd<T, Abi>(T(0)), x);
+
+  // a = j pi / 2 + r with |r| <= pi / 4
+  simd<T, Abi> j = Kokkos::round(a * c::two_over_pi);
+  simd<T, Abi> r = a - j * c::pi_2_1;
+  r              = r - j * c::pi_2_2;
+  r              = r - j * c::pi_2_3;
+  r              = r - j * c::pi_2_4;
+
+  simd<T, Abi> z = r * r;
+  simd<T, Abi> s = r + r * z * polynomial(z, c::sin);
+  simd<T, Abi> k = T(1) - (T(0.5) * z - z * z * polynomial(z, c::cos));
+
+  // cos(x) = sin(x + pi / 2)
+  j              = j + quadrant_offset;
+  simd<T, Abi> q = j - T(4) * Kokkos::floor(j * T(0.25));
+  simd<T, Abi> result = select(q == T(1) || q == T(3), k, s);
+  result              = select(q >= T(2), -result, result);
+
+  if (Kokkos::Experimental::any_of(out_of_range)) {
+    if (quadrant_offset == T(0)) {
+      result = scalar_fallback(out_of_range, x, result,
+                               [](T value) { return std::sin(value); });
+    } else {
+      result = scalar_fallback(out_of_range, x, result,
+                               [](T value) { return std::cos(value); });
+    }
+  }
+  return result;
+}
+
+}  // namespace impl
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    exp(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  return impl::exp(x, Kokkos::Experimental::basic_simd<T, Abi>(T(0)));
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    log(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  using simd_type = Kokkos::Experimental::basic_simd<T, Abi>;
+
+  constexpr T infinity = std::numeric_limits<T>::infinity();
+  auto finite          = (x > T(0)) && (x < infinity);
+
+  simd_type result = impl::log(impl::select(finite, x, simd_type(T(1))));
+
+  result = impl::select(x == infinity, x, result);
+  result = impl::select(x == T(0), simd_type(-infinity), result);
+  return impl::select(x < T(0) || x != x,
+                      simd_type(std::numeric_limits<T>::quiet_NaN()), result);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    sin(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  return impl::sin_cos(x, T(0));
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    cos(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  return impl::sin_cos(x, T(1));
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    tanh(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  using simd_type = Kokkos::Experimental::basic_simd<T, Abi>;
+  using c         = impl::constants<T>;
+
+  simd_type z     = x * x;
+  simd_type small = x + x * z * impl::polynomial(z, c::tanh);
+
+  // tanh(|x|) = 1 - 2 / (exp(2 |x|) + 1)
+  simd_type a     = Kokkos::abs(x);
+  simd_type large = T(1) - T(2) / (exp(a + a) + T(1));
+  large           = impl::select(x < T(0), -large, large);
+
+  return impl::select(a < c::tanh_min, small, large);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    erf(const Kokkos::Experimental::basic_simd<T, Abi>& x) {
+  using simd_type = Kokkos::Experimental::basic_simd<T, Abi>;
+  using c         = impl::constants<T>;
+
+  simd_type z     = x * x;
+  simd_type small = x * impl::polynomial(z, c::erf_small);
+
+  // erf(|x|) = 1 - exp(-x^2) erfc(|x|) exp(x^2)
+  simd_type a     = Kokkos::abs(x);
+  simd_type t     = T(1) / (T(1) + c::erf_scale * a) - c::erf_shift;
+  simd_type large = T(1) - exp(-z) * impl::polynomial(t, c::erf_large);
+  large           = impl::select(a >= c::erf_max, simd_type(T(1)), large);
+  large           = impl::select(x < T(0), -large, large);
+
+  return impl::select(a < T(1), small, large);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Kokkos::Experimental::basic_simd<T, Abi>
+    pow(const Kokkos::Experimental::basic_simd<T, Abi>& x,
+        const Kokkos::Experimental::basic_simd<T, Abi>& y) {
+  using simd_type = Kokkos::Experimental::basic_simd<T, Abi>;
+
+  constexpr T infinity = std::numeric_limits<T>::infinity();
+  constexpr T nan      = std::numeric_limits<T>::quiet_NaN();
+  simd_type a          = Kokkos::abs(x);
+  auto finite          = (a > T(0)) && (a < infinity);
+
+  // |x|^y = exp(y log(|x|)), with log(|x|) and its product by y in double-T
+  // precision
+  simd_type log_hi;
+  simd_type log_lo;
+  impl::log(impl::select(finite, a, simd_type(T(1))), log_hi, log_lo);
+  simd_type hi;
+  simd_type lo;
+  impl::two_product(y, log_hi, hi, lo);
+  lo               = lo + y * log_lo;
+  simd_type result = impl::exp(hi, lo);
+
+  // |x| = 0 or infinity
+  auto large = (a == infinity && y > T(0)) || (a == T(0) && y < T(0));
+  result     = impl::select(
+      finite, result,
+      impl::select(large, simd_type(infinity), simd_type(T(0))));
+  // |x| = 1 and y = +-infinity
+  result = impl::select(a == T(1), simd_type(T(1)), result);
+
+  // The sign for the negative x (and -0) and the odd y, NaN for the finite
+  // negative x and the non integer y
+  simd_type half_y = y * T(0.5);
+  auto integer     = Kokkos::floor(y) == y;
+  auto odd         = integer && Kokkos::floor(half_y) != half_y;
+  auto negative    = x < T(0) || (x == T(0) && T(1) / x < T(0));
+  result           = impl::select(negative && odd, -result, result);
+  result =
+      impl::select(x < T(0) && finite && !integer, simd_type(nan), result);
+
+  result = impl::select(x != x || y != y, x + y, result);
+  return impl::select(y == T(0) || x == T(1), simd_type(T(1)), result);
+}
+
+}  // namespace cexa::portable
+
+namespace Kokkos {
+
+// NOTE: The Kokkos overloads of the vector ABIs call the functions above, the
+// scalar ABIs keep the C library.
+
+#define CEXA_IMPL_PORTABLE_UNARY_FUNCTION(func, type, abi)        \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION             \
+      Experimental::basic_simd<type, Experimental::simd_abi::abi> \
+      func(Experimental::basic_simd<                              \
+           type, Experimental::simd_abi::abi> const& a) {         \
+    return cexa::portable::func(a);                               \
+  }
+
+#define CEXA_IMPL_PORTABLE_BINARY_FUNCTION(func, type, abi)       \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION             \
+      Experimental::basic_simd<type, Experimental::simd_abi::abi> \
+      func(Experimental::basic_simd<                              \
+               type, Experimental::simd_abi::abi> const& a,       \
+           Experimental::basic_simd<                              \
+               type, Experimental::simd_abi::abi> const& b) {     \
+    return cexa::portable::func(a, b);                            \
+  }
+
+// There are already calls to the svml intrinsics for exp and log in kokkos simd
+// when using an intel compiler
+#if KOKKOS_VERSION_LESS(5, 0, 0) || !defined(KOKKOS_COMPILER_INTEL_LLVM)
+#define CEXA_IMPL_PORTABLE_FUNCTIONS(type, abi)      \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(exp, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(log, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(sin, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(cos, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(tanh, type, abi) \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(erf, type, abi)  \
+  CEXA_IMPL_PORTABLE_BINARY_FUNCTION(pow, type, abi)
+#else
+#define CEXA_IMPL_PORTABLE_FUNCTIONS(type, abi)      \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(sin, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(cos, type, abi)  \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(tanh, type, abi) \
+  CEXA_IMPL_PORTABLE_UNARY_FUNCTION(erf, type, abi)  \
+  CEXA_IMPL_PORTABLE_BINARY_FUNCTION(pow, type, abi)
+#endif
+
+#if defined(KOKKOS_ARCH_AVX2)
+
+#include <Kokkos_SIMD_AVX2.hpp>
+
+CEXA_IMPL_PORTABLE_FUNCTIONS(double, avx2_fixed_size<4>)
+CEXA_IMPL_PORTABLE_FUNCTIONS(float, avx2_fixed_size<4>)
+CEXA_IMPL_PORTABLE_FUNCTIONS(float, avx2_fixed_size<8>)
+
+#elif defined(KOKKOS_ARCH_AVX512XEON)
+
+#include <Kokkos_SIMD_AVX512.hpp>
+
+CEXA_IMPL_PORTABLE_FUNCTIONS(double, avx512_fixed_size<8>)
+CEXA_IMPL_PORTABLE_FUNCTIONS(float, avx512_fixed_size<16>)
+CEXA_IMPL_PORTABLE_FUNCTIONS(float, avx512_fixed_size<8>)
+
+#elif defined(KOKKOS_ARCH_ARM_NEON)
+
+#include <Kokkos_SIMD_NEON.hpp>
+
+CEXA_IMPL_PORTABLE_FUNCTIONS(double, neon_fixed_size<2>)
+CEXA_IMPL_PORTABLE_FUNCTIONS(float, neon_fixed_size<4>)
+
+#endif
+
+}  // namespace Kokkos
+
+#undef CEXA_IMPL_PORTABLE_UNARY_FUNCTION
+#undef CEXA_IMPL_PORTABLE_BINARY_FUNCTION
+#undef CEXA_IMPL_PORTABLE_FUNCTIONS
+
+#endif
@@ -6,11 +6,15 @@
 #include <Kokkos_SIMD.hpp>
 #include <CEXA_SIMD_Backends.hpp>
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 using simd_type          = Kokkos::Experimental::simd<float>;
 constexpr int simd_width = simd_type::size();
 
-#define TEST_UNARY_FUNC(FUNC)                                           \
-  TEST(unary_functions, FUNC) {                                         \
+#define TEST_UNARY_FUNC_IMPL(SUITE, FUNC, CALL)                         \
+  TEST(SUITE, FUNC) {                                                   \
     float values[simd_width];                                           \
                                                                         \
     const float inf = std::numeric_limits<float>::infinity();           \
@@ -22,11 +26,17 @@ constexpr int simd_width = simd_type::size();
                                                                         \
     while (values[simd_width - 1] < inf) {                              \
       simd_type x(values, Kokkos::Experimental::simd_flag_default);     \
-      simd_type res = Kokkos::FUNC(x);                                  \
+      simd_type res = CALL(x);                                          \
                                                                         \
       for (int i = 0; i < simd_width; i++) {                            \
         float expected = std::FUNC(values[i]);                          \
-        EXPECT_FLOAT_EQ(res[i], expected) << "For value " << values[i]; \
+        /* EXPECT_FLOAT_EQ never holds for NaNs, whatever their sign */ \
+        if (std::isnan(expected)) {                                     \
+          EXPECT_TRUE(std::isnan(res[i])) << "For value " << values[i]; \
+        } else {                                                        \
+          EXPECT_FLOAT_EQ(res[i], expected)                             \
+              << "For value " << values[i];                             \
+        }                                                               \
       }                                                                 \
                                                                         \
       values[0] = std::nextafter(values[simd_width - 1], inf);          \
@@ -36,6 +46,12 @@ constexpr int simd_width = simd_type::size();
     }                                                                   \
   }
 
+#define TEST_UNARY_FUNC(FUNC) \
+  TEST_UNARY_FUNC_IMPL(unary_functions, FUNC, Kokkos::FUNC)
+// The 3.5 ULP variants, within the 4 ULP of EXPECT_FLOAT_EQ
+#define TEST_FAST_UNARY_FUNC(FUNC) \
+  TEST_UNARY_FUNC_IMPL(fast_unary_functions, FUNC, Kokkos::FUNC<cexa::fast>)
+
 TEST_UNARY_FUNC(exp)
 TEST_UNARY_FUNC(exp2)
 TEST_UNARY_FUNC(log)
@@ -61,6 +77,110 @@ TEST_UNARY_FUNC(tgamma)
 TEST_UNARY_FUNC(lgamma)
 #endif
 
+TEST_FAST_UNARY_FUNC(exp2)
+TEST_FAST_UNARY_FUNC(log)
+TEST_FAST_UNARY_FUNC(log2)
+TEST_FAST_UNARY_FUNC(cbrt)
+TEST_FAST_UNARY_FUNC(sin)
+TEST_FAST_UNARY_FUNC(cos)
+TEST_FAST_UNARY_FUNC(tan)
+TEST_FAST_UNARY_FUNC(asin)
+TEST_FAST_UNARY_FUNC(acos)
+TEST_FAST_UNARY_FUNC(atan)
+TEST_FAST_UNARY_FUNC(sinh)
+TEST_FAST_UNARY_FUNC(cosh)
+TEST_FAST_UNARY_FUNC(tanh)
+
+#if defined(CEXA_SIMD_ENABLE_PORTABLE)
+// Error of result in ULP of expected
+template <class T>
+double ulp_error(T result, T expected) {
+  if (std::isnan(expected)) return std::isnan(result) ? 0. : HUGE_VAL;
+  if (result == expected) return 0.;
+  if (std::isinf(expected)) return HUGE_VAL;
+
+  T magnitude = std::abs(expected);
+  T ulp = std::nextafter(magnitude, std::numeric_limits<T>::infinity()) -
+          magnitude;
+  return std::abs(double(result) - double(expected)) / double(ulp);
+}
+
+// The bounds of CEXA_SIMD_Portable.hpp plus 1 ULP for the error of the C
+// library. The values are sampled on [min, max], with the special values.
+template <class simd_type, class Func, class Reference>
+void test_portable_function(Func func, Reference reference, double min,
+                            double max, double max_error) {
+  using value_type        = typename simd_type::value_type;
+  constexpr int width     = simd_type::size();
+  constexpr int count     = 1 << 16;
+  const value_type inf    = std::numeric_limits<value_type>::infinity();
+  const value_type nan    = std::numeric_limits<value_type>::quiet_NaN();
+  const value_type small  = std::numeric_limits<value_type>::min();
+  const value_type denorm = std::numeric_limits<value_type>::denorm_min();
+
+  std::vector<value_type> values = {
+      0, -0., inf, -inf, nan, 1, -1, small, -small, denorm, 0.5, 1e6, -1e6,
+      1e30, -1e30};
+  for (int i = 0; i < count; i++) {
+    values.push_back(value_type(min + (max - min) * (i + 0.5) / count));
+  }
+  values.resize((values.size() + width - 1) / width * width, value_type(1));
+
+  for (std::size_t i = 0; i < values.size(); i += width) {
+    simd_type x(values.data() + i, Kokkos::Experimental::simd_flag_default);
+    simd_type res = func(x);
+
+    for (int j = 0; j < width; j++) {
+      value_type expected = reference(values[i + j]);
+      EXPECT_LE(ulp_error(value_type(res[j]), expected), max_error)
+          << "For value " << values[i + j] << ", result " << res[j]
+          << ", expected " << expected;
+    }
+  }
+}
+
+#define TEST_PORTABLE_FUNC(FUNC, MIN, MAX, MAX_ERROR)                       \
+  TEST(portable_functions, FUNC) {                                          \
+    using double_type = Kokkos::Experimental::simd<double>;                 \
+    using scalar_type = Kokkos::Experimental::basic_simd<                   \
+        double, Kokkos::Experimental::simd_abi::scalar>;                    \
+    auto reference = [](auto x) { return std::FUNC(x); };                   \
+                                                                            \
+    test_portable_function<simd_type>(                                      \
+        [](const simd_type& x) { return Kokkos::FUNC(x); }, reference, MIN, \
+        MAX, MAX_ERROR);                                                    \
+    test_portable_function<double_type>(                                    \
+        [](const double_type& x) { return Kokkos::FUNC(x); }, reference,    \
+        MIN, MAX, MAX_ERROR);                                               \
+    /* The scalar abi keeps the C library unless called explicitly */       \
+    test_portable_function<scalar_type>(                                    \
+        [](const scalar_type& x) { return cexa::portable::FUNC(x); },       \
+        reference, MIN, MAX, MAX_ERROR);                                    \
+  }
+
+TEST_PORTABLE_FUNC(exp, -750., 720., 2.1)
+TEST_PORTABLE_FUNC(log, 0., 1e3, 2.)
+TEST_PORTABLE_FUNC(sin, -1e3, 1e3, 3.5)
+TEST_PORTABLE_FUNC(cos, -1e3, 1e3, 3.5)
+TEST_PORTABLE_FUNC(tanh, -25., 25., 2.5)
+TEST_PORTABLE_FUNC(erf, -7., 7., 3.5)
+
+TEST(portable_functions, pow) {
+  using double_type = Kokkos::Experimental::simd<double>;
+
+  for (double y : {-30.5, -3., -0.5, 0., 0.5, 1., 2., 3., 7.25, 100.}) {
+    auto reference = [y](auto x) { return std::pow(x, decltype(x)(y)); };
+
+    test_portable_function<simd_type>(
+        [y](const simd_type& x) { return Kokkos::pow(x, simd_type(y)); },
+        reference, -10., 10., 3.);
+    test_portable_function<double_type>(
+        [y](const double_type& x) { return Kokkos::pow(x, double_type(y)); },
+        reference, -10., 10., 3.);
+  }
+}
+#endif
+
 // TODO: test binary and ternary functions
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+// Speedup of the cexa::fast variants of the simd math functions over the
+// cexa::accurate ones, for the native simd types. Only the functions for which
+// sleef provides a 3.5 ULP variant are measured, the others are the same with
+// both tags. Options: --size=<elements> --repetitions=<count>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+#include <CEXA_SIMD_Backends.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::size_t size        = std::size_t(1) << 16;
+std::size_t repetitions = 50;
+
+// Keeps the results alive
+volatile double sink = 0.;
+
+template <class simd_type>
+std::vector<typename simd_type::value_type> make_input(double min,
+                                                       double max) {
+  using value_type = typename simd_type::value_type;
+
+  std::vector<value_type> input(size);
+  for (std::size_t i = 0; i < size; i++) {
+    input[i] = value_type(min + (max - min) * double(i) / double(size));
+  }
+  return input;
+}
+
+// Best time over the repetitions, in nanoseconds per element
+template <class simd_type, class Func>
+double time_per_element(const std::vector<typename simd_type::value_type>& a,
+                        const std::vector<typename simd_type::value_type>& b,
+                        Func func) {
+  using value_type = typename simd_type::value_type;
+
+  double best = 1e30;
+  for (std::size_t repetition = 0; repetition < repetitions; repetition++) {
+    simd_type sum(value_type(0));
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i + simd_type::size() <= size;
+         i += simd_type::size()) {
+      simd_type x(a.data() + i, Kokkos::Experimental::simd_flag_default);
+      simd_type y(b.data() + i, Kokkos::Experimental::simd_flag_default);
+      sum = sum + func(x, y);
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    std::chrono::duration<double, std::nano> time = stop - start;
+    best = std::min(best, time.count() / double(size));
+    for (std::size_t lane = 0; lane < simd_type::size(); lane++) {
+      sink = sink + double(sum[lane]);
+    }
+  }
+  return best;
+}
+
+template <class simd_type, class Accurate, class Fast>
+void benchmark(const char* name, const char* type_name, double min, double max,
+               Accurate accurate, Fast fast) {
+  auto a = make_input<simd_type>(min, max);
+  // Reversed, for the second argument of the binary functions
+  auto b = a;
+  std::reverse(b.begin(), b.end());
+
+  double accurate_time = time_per_element<simd_type>(a, b, accurate);
+  double fast_time     = time_per_element<simd_type>(a, b, fast);
+
+  std::printf("%-8s %-8s %5zu %14.3f %14.3f %8.2fx\n", name, type_name,
+              std::size_t(simd_type::size()), accurate_time, fast_time,
+              accurate_time / fast_time);
+}
+
+#define CEXA_BENCHMARK_UNARY_FUNCTION(func, min, max) \
+  benchmark<simd_type>(                               \
+      #func, type_name, min, max,                     \
+      [](const simd_type& x, const simd_type&) {      \
+        return Kokkos::func<cexa::accurate>(x);       \
+      },                                              \
+      [](const simd_type& x, const simd_type&) {      \
+        return Kokkos::func<cexa::fast>(x);           \
+      });
+
+#define CEXA_BENCHMARK_BINARY_FUNCTION(func, min, max) \
+  benchmark<simd_type>(                                \
+      #func, type_name, min, max,                      \
+      [](const simd_type& x, const simd_type& y) {     \
+        return Kokkos::func<cexa::accurate>(x, y);     \
+      },                                               \
+      [](const simd_type& x, const simd_type& y) {     \
+        return Kokkos::func<cexa::fast>(x, y);         \
+      });
+
+template <class simd_type>
+void benchmark_functions(const char* type_name) {
+  CEXA_BENCHMARK_UNARY_FUNCTION(log, 1e-3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(log2, 1e-3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cbrt, -1e3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(sin, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cos, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(tan, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(asin, -1., 1.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(acos, -1., 1.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(atan, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(sinh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cosh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(tanh, -10., 10.)
+  CEXA_BENCHMARK_BINARY_FUNCTION(hypot, -10., 10.)
+  CEXA_BENCHMARK_BINARY_FUNCTION(atan2, -10., 10.)
+}
+
+#undef CEXA_BENCHMARK_UNARY_FUNCTION
+#undef CEXA_BENCHMARK_BINARY_FUNCTION
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg.rfind("--size=", 0) == 0) {
+      size = std::stoul(arg.substr(7));
+    } else if (arg.rfind("--repetitions=", 0) == 0) {
+      repetitions = std::stoul(arg.substr(14));
+    }
+  }
+
+  std::printf("%-8s %-8s %5s %14s %14s %9s\n", "function", "type", "width",
+              "accurate (ns)", "fast (ns)", "speedup");
+  benchmark_functions<Kokkos::Experimental::simd<float>>("float");
+  benchmark_functions<Kokkos::Experimental::simd<double>>("double");
+
+  return 0;
+}
@@ -0,0 +1,494 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+// Cost per element of every simd math function the backends wrap, for the
+// simd types the backends overload on the architecture Kokkos is built for
+// (avx2 float4, float8 and double4, or avx512 float8, float16 and double8),
+// in two modes:
+// - throughput: independent calls over an array,
+// - latency: each call takes the result of the previous one as argument.
+//
+// The implementations compared are:
+// - libm: the scalar C library, element by element,
+// - kokkos: the C library lane by lane, which is what Kokkos does without a
+//   backend,
+// - the enabled backend (svml, libmvec or portable), or for sleef its
+//   cexa::accurate and cexa::fast variants (sleef_accurate and sleef_fast),
+//   one of which is the default depending on CEXA_SIMD_SLEEF_FAST. The
+//   functions the backend does not wrap are reported as n/a.
+// Only one backend can be enabled per build: build once per backend and merge
+// the json files to compare them.
+//
+// The costs are in cycles of the time stamp counter on x86 (which runs at the
+// nominal frequency, so disable frequency scaling for stable results) and in
+// nanoseconds elsewhere.
+// Options: --size=<elements> --repetitions=<count> --json=<file>, the size
+// being a multiple of the widest simd type
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+#include <CEXA_SIMD_Backends.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#if defined(_M_X64)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#if defined(CEXA_SIMD_ENABLE_LIBMVEC)
+// For __GLIBC_PREREQ
+#include <features.h>
+#endif
+
+namespace {
+
+// Width of the widest simd type benchmarked, avx512 float16
+constexpr std::size_t max_width = 16;
+
+std::size_t size        = std::size_t(1) << 14;
+std::size_t repetitions = 20;
+std::string json_file   = "math_benchmark.json";
+
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+constexpr const char* backend = "sleef";
+#if defined(CEXA_SIMD_SLEEF_FAST)
+constexpr const char* default_accuracy = "fast";
+#else
+constexpr const char* default_accuracy = "accurate";
+#endif
+#elif defined(CEXA_SIMD_ENABLE_SVML)
+constexpr const char* backend = "svml";
+#elif defined(CEXA_SIMD_ENABLE_LIBMVEC)
+constexpr const char* backend = "libmvec";
+#elif defined(CEXA_SIMD_ENABLE_PORTABLE)
+constexpr const char* backend = "portable";
+#else
+constexpr const char* backend = nullptr;
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+constexpr const char* unit = "cycles";
+
+std::uint64_t now() { return __rdtsc(); }
+#else
+constexpr const char* unit = "ns";
+
+std::uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+#endif
+
+// Keeps the results alive
+volatile double sink = 0.;
+// Multiplies the results of the latency chains without the compiler knowing
+volatile double zero = 0.;
+
+struct result {
+  std::string function;
+  std::string abi;
+  std::size_t width;
+  std::string implementation;
+  std::string mode;
+  double cost;
+};
+
+std::vector<result> results;
+
+// Best cost over the repetitions, per element
+template <class Body>
+double cost_per_element(Body body) {
+  double best = 1e30;
+  for (std::size_t repetition = 0; repetition < repetitions; repetition++) {
+    std::uint64_t start = now();
+    body();
+    std::uint64_t stop = now();
+    best = std::min(best, double(stop - start) / double(size));
+  }
+  return best;
+}
+
+template <class T>
+void keep(const std::vector<T>& values) {
+  double sum = 0.;
+  for (T value : values) sum += double(value);
+  sink = sink + sum;
+}
+
+template <class Scalar, class T>
+double scalar_throughput(Scalar scalar, const std::vector<T>& a,
+                         const std::vector<T>& b) {
+  std::vector<T> out(size);
+  double cost = cost_per_element([&] {
+    for (std::size_t i = 0; i < size; i++) out[i] = scalar(a[i], b[i]);
+  });
+  keep(out);
+  return cost;
+}
+
+// x = x0 + f(x) * 0 keeps x in the domain of f. x0 is taken in the middle of
+// the inputs, as the cost of some functions depends on the argument (e.g. the
+// special cases at the ends of the range). The cost of the multiply and add is
+// measured with the identity and subtracted.
+template <class Scalar, class T>
+double scalar_latency(Scalar scalar, const std::vector<T>& a,
+                      const std::vector<T>& b) {
+  auto chain = [&](auto func) {
+    const T x0 = a[size / 2];
+    T x        = x0;
+    T y        = b[size / 2];
+    T z        = T(zero);
+    double cost = cost_per_element([&] {
+      for (std::size_t i = 0; i < size; i++) x = x0 + func(x, y) * z;
+    });
+    sink = sink + double(x);
+    return cost;
+  };
+  return chain(scalar) - chain([](T x, T) { return x; });
+}
+
+template <class simd_type, class Func>
+double simd_throughput(Func func,
+                       const std::vector<typename simd_type::value_type>& a,
+                       const std::vector<typename simd_type::value_type>& b) {
+  constexpr std::size_t width = simd_type::size();
+
+  std::vector<typename simd_type::value_type> out(size);
+  double cost = cost_per_element([&] {
+    for (std::size_t i = 0; i + width <= size; i += width) {
+      simd_type x(a.data() + i, Kokkos::Experimental::simd_flag_default);
+      simd_type y(b.data() + i, Kokkos::Experimental::simd_flag_default);
+      func(x, y).copy_to(out.data() + i,
+                         Kokkos::Experimental::simd_flag_default);
+    }
+  });
+  keep(out);
+  return cost;
+}
+
+template <class simd_type, class Func>
+double simd_latency(Func func,
+                    const std::vector<typename simd_type::value_type>& a,
+                    const std::vector<typename simd_type::value_type>& b) {
+  using value_type            = typename simd_type::value_type;
+  constexpr std::size_t width = simd_type::size();
+
+  // The vector of the middle of the inputs, see scalar_latency
+  const std::size_t middle = size / 2 / width * width;
+
+  auto chain = [&](auto f) {
+    simd_type x0(a.data() + middle, Kokkos::Experimental::simd_flag_default);
+    simd_type y(b.data() + middle, Kokkos::Experimental::simd_flag_default);
+    simd_type z(static_cast<value_type>(zero));
+    simd_type x = x0;
+    double cost = cost_per_element([&] {
+      for (std::size_t i = 0; i + width <= size; i += width) {
+        x = x0 + f(x, y) * z;
+      }
+    });
+    for (std::size_t lane = 0; lane < width; lane++) {
+      sink = sink + double(x[lane]);
+    }
+    return cost;
+  };
+  return chain(func) -
+         chain([](const simd_type& x, const simd_type&) { return x; });
+}
+
+template <class simd_type>
+std::vector<typename simd_type::value_type> make_input(double min,
+                                                       double max) {
+  using value_type = typename simd_type::value_type;
+
+  std::vector<value_type> input(size);
+  for (std::size_t i = 0; i < size; i++) {
+    input[i] = value_type(min + (max - min) * double(i) / double(size));
+  }
+  return input;
+}
+
+// Whether the enabled backend overloads function, see the backend headers. The
+// other functions fall back to Kokkos, so their backend columns are reported
+// as n/a rather than timing Kokkos under the name of the backend
+bool backend_wraps(const std::string& function) {
+  [[maybe_unused]] auto is_one_of =
+      [&](std::initializer_list<const char*> functions) {
+        return std::find(functions.begin(), functions.end(), function) !=
+               functions.end();
+      };
+
+#if !KOKKOS_VERSION_LESS(5, 0, 0) && defined(KOKKOS_COMPILER_INTEL_LLVM)
+  // Kokkos already calls the svml for these functions
+  if (is_one_of({"exp", "log"})) return false;
+#if !defined(CEXA_SIMD_ENABLE_PORTABLE)
+  if (function == "cbrt") return false;
+#endif
+#endif
+
+#if defined(CEXA_SIMD_ENABLE_PORTABLE)
+  return is_one_of({"exp", "log", "sin", "cos", "tanh", "erf", "pow"});
+#elif defined(CEXA_SIMD_ENABLE_LIBMVEC)
+#if __GLIBC_PREREQ(2, 35)
+  return !is_one_of({"tgamma", "lgamma"});
+#else
+  return is_one_of({"exp", "log", "sin", "cos", "pow"});
+#endif
+#elif defined(CEXA_SIMD_ENABLE_SVML)
+  return !is_one_of({"tgamma", "lgamma"});
+#else
+  return backend != nullptr;
+#endif
+}
+
+template <class simd_type, class Scalar, class Func, class AccurateFunc,
+          class FastFunc>
+void benchmark(const char* name, const char* abi, double min, double max,
+               Scalar scalar, [[maybe_unused]] Func func,
+               [[maybe_unused]] AccurateFunc accurate_func,
+               [[maybe_unused]] FastFunc fast_func) {
+  auto a = make_input<simd_type>(min, max);
+  // Reversed, for the second argument of the binary functions
+  auto b = a;
+  std::reverse(b.begin(), b.end());
+
+  // The lane by lane loop of Kokkos without a backend
+  auto lanes = [&scalar](const simd_type& x, const simd_type& y) {
+    typename simd_type::value_type values[simd_type::size()];
+    for (std::size_t lane = 0; lane < simd_type::size(); lane++) {
+      values[lane] = scalar(x[lane], y[lane]);
+    }
+    return simd_type(values, Kokkos::Experimental::simd_flag_default);
+  };
+
+  auto add = [&](const char* implementation, double throughput,
+                 double latency) {
+    results.push_back({name, abi, std::size_t(simd_type::size()),
+                       implementation, "throughput", throughput});
+    results.push_back({name, abi, std::size_t(simd_type::size()),
+                       implementation, "latency", latency});
+  };
+
+  // NaN for the functions the backend does not wrap, printed as n/a
+  auto add_backend = [&](const char* implementation, auto backend_func) {
+    if (backend_wraps(name)) {
+      add(implementation, simd_throughput<simd_type>(backend_func, a, b),
+          simd_latency<simd_type>(backend_func, a, b));
+    } else {
+      add(implementation, std::nan(""), std::nan(""));
+    }
+  };
+
+  add("libm", scalar_throughput(scalar, a, b), scalar_latency(scalar, a, b));
+  add("kokkos", simd_throughput<simd_type>(lanes, a, b),
+      simd_latency<simd_type>(lanes, a, b));
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+  // The calls without a tag run one of the two, see CEXA_SIMD_SLEEF_FAST
+  add_backend("sleef_accurate", accurate_func);
+  add_backend("sleef_fast", fast_func);
+#else
+  if (backend) {
+    add_backend(backend, func);
+  }
+#endif
+}
+
+#define CEXA_BENCHMARK_UNARY_FUNCTION(func, min, max) \
+  benchmark<simd_type>(                               \
+      #func, abi, min, max,                           \
+      [](value_type x, value_type) {                  \
+        return value_type(std::func(x));              \
+      },                                              \
+      [](const simd_type& x, const simd_type&) {      \
+        return Kokkos::func(x);                       \
+      },                                              \
+      [](const simd_type& x, const simd_type&) {      \
+        return Kokkos::func<cexa::accurate>(x);       \
+      },                                              \
+      [](const simd_type& x, const simd_type&) {      \
+        return Kokkos::func<cexa::fast>(x);           \
+      });
+
+#define CEXA_BENCHMARK_BINARY_FUNCTION(func, min, max) \
+  benchmark<simd_type>(                                \
+      #func, abi, min, max,                            \
+      [](value_type x, value_type y) {                 \
+        return value_type(std::func(x, y));            \
+      },                                               \
+      [](const simd_type& x, const simd_type& y) {     \
+        return Kokkos::func(x, y);                     \
+      },                                               \
+      [](const simd_type& x, const simd_type& y) {     \
+        return Kokkos::func<cexa::accurate>(x, y);     \
+      },                                               \
+      [](const simd_type& x, const simd_type& y) {     \
+        return Kokkos::func<cexa::fast>(x, y);         \
+      });
+
+// The ranges keep the results finite, for the latency chains
+template <class simd_type>
+void benchmark_functions(const char* abi) {
+  using value_type = typename simd_type::value_type;
+
+  CEXA_BENCHMARK_UNARY_FUNCTION(exp, -20., 20.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(exp2, -20., 20.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(log, 1e-3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(log10, 1e-3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(log2, 1e-3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cbrt, -1e3, 1e3)
+  CEXA_BENCHMARK_UNARY_FUNCTION(sin, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cos, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(tan, -1.5, 1.5)
+  CEXA_BENCHMARK_UNARY_FUNCTION(asin, -1., 1.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(acos, -1., 1.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(atan, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(sinh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(cosh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(tanh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(asinh, -10., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(acosh, 1., 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(atanh, -0.99, 0.99)
+  CEXA_BENCHMARK_UNARY_FUNCTION(erf, -5., 5.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(erfc, -5., 5.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(tgamma, 0.1, 10.)
+  CEXA_BENCHMARK_UNARY_FUNCTION(lgamma, 0.1, 10.)
+  CEXA_BENCHMARK_BINARY_FUNCTION(pow, 0.1, 10.)
+  CEXA_BENCHMARK_BINARY_FUNCTION(hypot, -10., 10.)
+  CEXA_BENCHMARK_BINARY_FUNCTION(atan2, -10., 10.)
+}
+
+#undef CEXA_BENCHMARK_UNARY_FUNCTION
+#undef CEXA_BENCHMARK_BINARY_FUNCTION
+
+std::vector<std::string> implementations() {
+  std::vector<std::string> names = {"libm", "kokkos"};
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+  names.push_back("sleef_accurate");
+  names.push_back("sleef_fast");
+#else
+  if (backend) names.push_back(backend);
+#endif
+  return names;
+}
+
+// One line per function, simd type and mode, one column per implementation
+void print_table() {
+  auto names = implementations();
+
+  std::printf("%-8s %-16s %-10s", "function", "abi", "mode");
+  for (const auto& name : names) std::printf(" %14s", name.c_str());
+  std::printf("   (%s per element)\n", unit);
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+  std::printf("The calls without an accuracy tag run sleef_%s\n",
+              default_accuracy);
+#endif
+
+  for (std::size_t i = 0; i < results.size(); i += 2 * names.size()) {
+    for (std::size_t mode = 0; mode < 2; mode++) {
+      const result& first = results[i + mode];
+      std::printf("%-8s %-16s %-10s", first.function.c_str(),
+                  first.abi.c_str(), first.mode.c_str());
+      for (std::size_t j = 0; j < names.size(); j++) {
+        const double cost = results[i + 2 * j + mode].cost;
+        if (std::isnan(cost)) {
+          std::printf(" %14s", "n/a");
+        } else {
+          std::printf(" %14.2f", cost);
+        }
+      }
+      std::printf("\n");
+    }
+  }
+}
+
+void write_json() {
+  std::FILE* file = std::fopen(json_file.c_str(), "w");
+  if (!file) {
+    std::fprintf(stderr, "Cannot write %s\n", json_file.c_str());
+    return;
+  }
+
+  std::fprintf(file, "{\n  \"backend\": \"%s\",\n  \"unit\": \"%s\",\n",
+               backend ? backend : "none", unit);
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+  std::fprintf(file, "  \"default_accuracy\": \"%s\",\n", default_accuracy);
+#endif
+  std::fprintf(file, "  \"results\": [\n");
+  for (std::size_t i = 0; i < results.size(); i++) {
+    const result& r = results[i];
+    // null for the functions the backend does not wrap
+    char cost[32] = "null";
+    if (!std::isnan(r.cost)) {
+      std::snprintf(cost, sizeof(cost), "%.4f", r.cost);
+    }
+    std::fprintf(file,
+                 "    {\"function\": \"%s\", \"abi\": \"%s\", \"width\": %zu, "
+                 "\"implementation\": \"%s\", \"mode\": \"%s\", "
+                 "\"per_element\": %s}%s\n",
+                 r.function.c_str(), r.abi.c_str(), r.width,
+                 r.implementation.c_str(), r.mode.c_str(), cost,
+                 i + 1 < results.size() ? "," : "");
+  }
+  std::fprintf(file, "  ]\n}\n");
+  std::fclose(file);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg.rfind("--size=", 0) == 0) {
+      size = std::stoul(arg.substr(7));
+    } else if (arg.rfind("--repetitions=", 0) == 0) {
+      repetitions = std::stoul(arg.substr(14));
+    } else if (arg.rfind("--json=", 0) == 0) {
+      json_file = arg.substr(7);
+    }
+  }
+  // Every simd type reads whole vectors of the inputs
+  if (size < max_width || size % max_width != 0) {
+    std::fprintf(stderr, "--size must be a non-zero multiple of %zu\n",
+                 max_width);
+    return EXIT_FAILURE;
+  }
+
+  namespace simd_abi = Kokkos::Experimental::simd_abi;
+  using Kokkos::Experimental::basic_simd;
+
+#if defined(KOKKOS_ARCH_AVX512XEON)
+  benchmark_functions<basic_simd<float, simd_abi::avx512_fixed_size<8>>>(
+      "avx512_float8");
+  benchmark_functions<basic_simd<float, simd_abi::avx512_fixed_size<16>>>(
+      "avx512_float16");
+  benchmark_functions<basic_simd<double, simd_abi::avx512_fixed_size<8>>>(
+      "avx512_double8");
+#elif defined(KOKKOS_ARCH_AVX2)
+  benchmark_functions<basic_simd<float, simd_abi::avx2_fixed_size<4>>>(
+      "avx2_float4");
+  benchmark_functions<basic_simd<float, simd_abi::avx2_fixed_size<8>>>(
+      "avx2_float8");
+  benchmark_functions<basic_simd<double, simd_abi::avx2_fixed_size<4>>>(
+      "avx2_double4");
+#else
+  benchmark_functions<Kokkos::Experimental::simd<float>>("native_float");
+  benchmark_functions<Kokkos::Experimental::simd<double>>("native_double");
+#endif
+
+  print_table();
+  write_json();
+
+  return 0;
+}
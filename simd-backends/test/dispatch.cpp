@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2026 CExA-project
+// SPDX-License-Identifier: MIT or Apache-2.0 with LLVM-exception
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <CEXA_SIMD_Dispatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+using cexa::dispatch::isa;
+
+// Every ISA up to the one of the CPU, on sizes that cover the remainders of
+// the vectors of every width
+template <class T, class Func, class Reference>
+void test_dispatch(Func func, Reference reference, double min, double max) {
+  for (isa target : {isa::scalar, isa::avx2, isa::avx512}) {
+    if (target > cexa::dispatch::selected_isa()) continue;
+
+    for (std::size_t n = 0; n <= 35; n++) {
+      std::vector<T> x(n);
+      std::vector<T> y(n);
+      for (std::size_t i = 0; i < n; i++) {
+        x[i] = T(min + (max - min) * double(i) / 35.);
+      }
+      func(x.data(), y.data(), n, target);
+
+      for (std::size_t i = 0; i < n; i++) {
+        if constexpr (std::is_same_v<T, float>) {
+          EXPECT_FLOAT_EQ(y[i], reference(x[i]))
+              << "For value " << x[i] << " with " << isa_name(target);
+        } else {
+          EXPECT_DOUBLE_EQ(y[i], reference(x[i]))
+              << "For value " << x[i] << " with " << isa_name(target);
+        }
+      }
+    }
+  }
+}
+
+#define TEST_DISPATCH_UNARY_FUNC(FUNC, MIN, MAX)                        \
+  TEST(dispatch, FUNC) {                                                \
+    auto func = [](const auto* x, auto* y, std::size_t n, isa target) { \
+      cexa::dispatch::FUNC(x, y, n, target);                            \
+    };                                                                  \
+    auto reference = [](auto x) { return std::FUNC(x); };               \
+    test_dispatch<float>(func, reference, MIN, MAX);                    \
+    test_dispatch<double>(func, reference, MIN, MAX);                   \
+  }
+
+#define TEST_DISPATCH_BINARY_FUNC(FUNC, MIN, MAX)                             \
+  TEST(dispatch, FUNC) {                                                      \
+    /* FUNC(x, 1 / x) */                                                      \
+    auto func = [](const auto* x, auto* y, std::size_t n, isa target) {       \
+      using T = std::remove_const_t<std::remove_pointer_t<decltype(x)>>;      \
+      std::vector<T> inverse(n);                                              \
+      for (std::size_t i = 0; i < n; i++) inverse[i] = T(1) / x[i];           \
+      cexa::dispatch::FUNC(x, inverse.data(), y, n, target);                  \
+    };                                                                        \
+    auto reference = [](auto x) { return std::FUNC(x, decltype(x)(1) / x); }; \
+    test_dispatch<float>(func, reference, MIN, MAX);                          \
+    test_dispatch<double>(func, reference, MIN, MAX);                         \
+  }
+
+// Every function of CEXA_SIMD_Dispatch.hpp, on domains that stay away from
+// their zeros, where the relative errors are large
+TEST_DISPATCH_UNARY_FUNC(exp, -20., 20.)
+TEST_DISPATCH_UNARY_FUNC(log, 1e-3, 1e3)
+TEST_DISPATCH_UNARY_FUNC(sin, -10., 10.)
+TEST_DISPATCH_UNARY_FUNC(cos, -10., 10.)
+TEST_DISPATCH_BINARY_FUNC(pow, 0.1, 10.)
+
+// Provided by libmvec since glibc 2.35
+#if defined(CEXA_SIMD_ENABLE_LIBMVEC) && !__GLIBC_PREREQ(2, 35)
+#define CEXA_TEST_DISPATCH_GLIBC_2_35 0
+#else
+#define CEXA_TEST_DISPATCH_GLIBC_2_35 1
+#endif
+
+#if CEXA_TEST_DISPATCH_GLIBC_2_35
+TEST_DISPATCH_UNARY_FUNC(exp2, -20., 20.)
+TEST_DISPATCH_UNARY_FUNC(log10, 1e-3, 1e3)
+TEST_DISPATCH_UNARY_FUNC(log2, 1e-3, 1e3)
+TEST_DISPATCH_UNARY_FUNC(cbrt, -1e3, 1e3)
+TEST_DISPATCH_UNARY_FUNC(tan, -1.5, 1.5)
+TEST_DISPATCH_UNARY_FUNC(asin, -0.9, 0.9)
+TEST_DISPATCH_UNARY_FUNC(acos, -0.9, 0.9)
+TEST_DISPATCH_UNARY_FUNC(atan, -10., 10.)
+TEST_DISPATCH_UNARY_FUNC(sinh, -10., 10.)
+TEST_DISPATCH_UNARY_FUNC(cosh, -10., 10.)
+TEST_DISPATCH_UNARY_FUNC(tanh, -5., 5.)
+TEST_DISPATCH_UNARY_FUNC(asinh, -10., 10.)
+TEST_DISPATCH_UNARY_FUNC(acosh, 1.5, 10.)
+TEST_DISPATCH_UNARY_FUNC(atanh, -0.9, 0.9)
+TEST_DISPATCH_UNARY_FUNC(erf, -3., 3.)
+TEST_DISPATCH_UNARY_FUNC(erfc, -3., 3.)
+TEST_DISPATCH_BINARY_FUNC(hypot, 0.1, 10.)
+TEST_DISPATCH_BINARY_FUNC(atan2, 0.1, 10.)
+#endif
+
+#if defined(CEXA_SIMD_ENABLE_SLEEF)
+TEST_DISPATCH_UNARY_FUNC(tgamma, 0.5, 10.)
+TEST_DISPATCH_UNARY_FUNC(lgamma, 2.5, 20.)
+#endif
+
+// CEXA_SIMD_DISPATCH_ISA lowers the detected ISA, and is ignored when it is
+// unknown or asks for an ISA the CPU does not support
+TEST(dispatch, environment) {
+  const isa best = cexa::dispatch::selected_isa();
+
+  setenv("CEXA_SIMD_DISPATCH_ISA", "scalar", 1);
+  EXPECT_EQ(cexa::dispatch::detect_isa(), isa::scalar);
+  setenv("CEXA_SIMD_DISPATCH_ISA", "avx2", 1);
+  EXPECT_EQ(cexa::dispatch::detect_isa(), std::min(best, isa::avx2));
+  setenv("CEXA_SIMD_DISPATCH_ISA", "avx512", 1);
+  EXPECT_EQ(cexa::dispatch::detect_isa(), best);
+  setenv("CEXA_SIMD_DISPATCH_ISA", "sse2", 1);
+  EXPECT_EQ(cexa::dispatch::detect_isa(), best);
+  unsetenv("CEXA_SIMD_DISPATCH_ISA");
+  EXPECT_EQ(cexa::dispatch::detect_isa(), best);
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::ScopeGuard guard(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  int result = RUN_ALL_TESTS();
+  return result;
+}